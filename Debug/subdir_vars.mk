@@ -1,47 +0,0 @@
-################################################################################
-# Automatically-generated file. Do not edit!
-################################################################################
-
-# Add inputs and outputs from these tool invocations to the build variables 
-CMD_SRCS += \
-../lnk_msp430f5438a.cmd 
-
-ASM_SRCS += \
-../ISR.asm 
-
-C_SRCS += \
-../combination.c \
-../main.c 
-
-C_DEPS += \
-./combination.d \
-./main.d 
-
-OBJS += \
-./ISR.obj \
-./combination.obj \
-./main.obj 
-
-ASM_DEPS += \
-./ISR.d 
-
-OBJS__QUOTED += \
-"ISR.obj" \
-"combination.obj" \
-"main.obj" 
-
-C_DEPS__QUOTED += \
-"combination.d" \
-"main.d" 
-
-ASM_DEPS__QUOTED += \
-"ISR.d" 
-
-ASM_SRCS__QUOTED += \
-"../ISR.asm" 
-
-C_SRCS__QUOTED += \
-"../combination.c" \
-"../main.c" 
-
-
@@ -1,47 +1,121 @@
 ;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
-; Implrementacija asemblerskih prekidnih rutina za tajmer i AD konverziju
+; Implrementacija asemblerskih prekidnih rutina za tajmer (multipleksiranje LED displeja)
+; i AD konverziju
+;
+; Svaka rutina cuva tacno one registre koje menja. Broj ciklusa je racunat po tabeli
+; ciklusa MSP430X CPU iz korisnickog uputstva familije 5xx (prihvatanje prekida 6,
+; RETI 5, PUSH Rn 3, POP Rn 2, CALL #x 4) i ukljucuje ulazak i izlazak iz prekida.
+;
+; Sa --define=PROFILE rutine na ulazu i izlazu pozivaju PROFILE_BEGIN/PROFILE_END (profile.h),
+; a navedeni broj ciklusa vazi bez profilisanja.
+;
+; Ako se projekat prevodi sa --define=ISR_C_FALLBACK, ove rutine se izostavljaju i
+; koriste se ekvivalentne C rutine iz main.c, pa se dve verzije mogu uporediti u simulatoru.
 ;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
 
-			.cdecls C,LIST,"msp430.h"       ; Ukljucivanje header fajla uredjaja
+			.cdecls C,LIST,"msp430.h","profile.h" ; Ukljucivanje header fajla uredjaja i mesta profilisanja
+
+	.if $$isdefed("ISR_C_FALLBACK") = 0
 
-			.ref	current_state           ; Referenca na promenljivu current_state
 			.ref	ad_result               ; Reference na promenljivu ad_result
+			.ref	ad_symbol               ; Referenca na simbol izabran potenciometrom
+			.ref	ADC_symbol_map          ; Referenca na funkciju za mapiranje simbola (combination.c)
+			.ref	timer_ticks             ; Referenca na brojac perioda tajmera (timestamp.c)
+			.ref	entropy_adc             ; Referenca na akumulator ADC entropije (entropy.c)
+			.ref	display_framebuffer     ; Referenca na bafer LED displeja (combination.c)
+			.ref	display_scan            ; Referenca na indeks displeja koji se sledeci ispisuje (main.c)
+			.ref	display_select_p11      ; Reference na tabele selekcionih bita (main.c)
+			.ref	display_select_p10
+
+; Profilisanje (profile.h): belezenje pocetka i racunanje trajanja za dato mesto
+	.if $$isdefed("PROFILE")
+			.ref	profile_start
+			.ref	profile_end
+	.endif
+
+PROFILE_BEGIN	.macro	site
+	.if $$isdefed("PROFILE")
+			mov.w	&TB0R, &profile_start + 2 * :site:
+	.endif
+	.endm
+
+PROFILE_END	.macro	site
+	.if $$isdefed("PROFILE")
+			push.w	R12                     ; profile_end je C funkcija, pa se cuvaju R12-R15
+			push.w	R13
+			push.w	R14
+			push.w	R15
+			mov.w	#:site:, R12
+			call	#profile_end
+			pop.w	R15
+			pop.w	R14
+			pop.w	R13
+			pop.w	R12
+	.endif
+	.endm
 
 ; TIMER0A0 ISR
+; U svakoj periodi tajmera (oko 1.95ms) ispisuje se sledeci LED displej iz bafera
+; display_framebuffer. AD konverzije pokrece hardverski izlaz TA0.1, bez ove rutine.
+; Trajanje: 62 ciklusa.
 			.text
-CCR0ISR		push.w	R8						; Cuvanje R8 i R9 na steku
-			push.w	R9
-            mov.w   #0000h, R11				; Praznjenje registra R11
-			mov.b   current_state, R11      ; Pomeranje vrednosti current_state u R11
-			cmp.b 	#005h, R11              ; Provera da li smo u stanju SELECT_SYMBOL (5)
-			jnz		timer_exit
-		    bis.w   #ADC12SC,&ADC12CTL0     ; Startovanje AD konverzija ako jesmo u stanju SELECT_SYMBOL
-timer_exit  pop.w	R9						; Vracanje registara R8 i R9
-			pop.w	R8
-			reti
-
+CCR0ISR		PROFILE_BEGIN	PROFILE_SITE_CCR0
+			push.w	R12                     ; (3) Cuvanje R12, jedinog registra koji se koristi
+			inc.w	&timer_ticks            ; (4) Jos jedan period tajmera za timestamp_now(),
+			adc.w	&timer_ticks+2          ; (4) 32-bitni brojac (prenos u visu rec)
+			bis.b	#BIT1|BIT0, &P11OUT     ; (5) Gasenje sva 4 displeja (selekcija je aktivna na nuli)
+			bis.b	#BIT7|BIT6, &P10OUT     ; (5)
+			mov.w	&display_scan, R12      ; (3) Indeks displeja koji se sada ispisuje [0;3]
+			mov.b	display_framebuffer(R12), &P6OUT ; (6) Segmenti za taj displej
+			bic.b	display_select_p11(R12), &P11OUT ; (6) Paljenje izabranog displeja
+			bic.b	display_select_p10(R12), &P10OUT ; (6)
+			inc.w	R12                     ; (1) Sledeci displej, u krug
+			and.w	#0003h, R12             ; (2)
+			mov.w	R12, &display_scan      ; (4)
+			pop.w	R12                     ; (2) Vracanje R12
+			PROFILE_END	PROFILE_SITE_CCR0
+			reti                            ; (5)
 
 ; ADC12 ISR
+; Prekid se javlja jednom na 8 odbiraka, kada se popuni MEM7 (kraj sekvence MEM0..MEM7).
+; Odbirci se sabiraju (zbir 8 12-bitnih vrednosti staje u 15 bita), usrednjavaju i
+; mapiraju na simbol preko ADC_symbol_map (combination.c) uz histerezis.
+; Trajanje: 90 ciklusa + ADC_symbol_map, raspodeljeno na 8 odbiraka (oko 11 ciklusa po odbirku).
+; C funkcija sme da menja R12-R15, pa se cuvaju sva cetiri registra.
             .text
-ADC12ISR    push.w  R8                            ; Cuvanje R8 i R9 na steku
-            push.w  R9
-            mov.w   #0000h, R13                   ; Praznjenje registra R13
-            cmp     #ADC12IV_ADC12IFG0,&ADC12IV   ; Proverava se da li je trigerovan interrupt za AD konverziju
-            jnz     adc_exit
-            mov.w   ADC12MEM0,R13				  ; Ako jeste, iz registra MEM0 prepisuje se vrednost u registar R13
-            rra		R13                           ; 1. rotacija registra R13
-            rra		R13                           ; 2. rotacija registra R13
-            rra		R13                           ; 3. rotacija registra R13
-            rra		R13                           ; 4. rotacija registra R13
-            rra		R13                           ; 5. rotacija registra R13
-            rra		R13                           ; 6. rotacija registra R13
-            rra		R13                           ; 7. rotacija registra R13
-            rra		R13                           ; 8. rotacija registra R13 ---> dobili smo 4 najvisa bita na najnizim pozicijama, kao shift u levo za 8 mesta
-            and     #000fh, R13					  ; And-ovanje sa maskom koja uzima samo najniza 4 bita
-           	mov.w   R13, ad_result				  ; Prebacivanje rezultata iz registra R13 u promenljivu ad_result
-adc_exit    pop.w   R9                            ; Vracanje registara R8 i R9
-            pop.w   R8
-            reti
+ADC12ISR    PROFILE_BEGIN	PROFILE_SITE_ADC12
+            push.w  R12                           ; (3) Cuvanje registara R12-R15
+            push.w  R13                           ; (3)
+            push.w  R14                           ; (3)
+            push.w  R15                           ; (3)
+            cmp.w   #ADC12IV_ADC12IFG7, &ADC12IV  ; (5) Proverava se da li je zavrsena cela sekvenca
+            jnz     adc_exit                      ; (2)
+            mov.w   &ADC12MEM0, R12               ; (3) Sabiranje svih 8 odbiraka u registar R12
+            add.w   &ADC12MEM1, R12               ; (3)
+            add.w   &ADC12MEM2, R12               ; (3)
+            add.w   &ADC12MEM3, R12               ; (3)
+            add.w   &ADC12MEM4, R12               ; (3)
+            add.w   &ADC12MEM5, R12               ; (3)
+            add.w   &ADC12MEM6, R12               ; (3)
+            add.w   &ADC12MEM7, R12               ; (3)
+            mov.w   &entropy_adc, R13             ; (3) Najnizi (sumni) bitovi se umesavaju u akumulator
+            xor.w   R12, R13                      ; (1) entropije, koji se zatim rotira ulevo za 1 mesto
+            rla.w   R13                           ; (1)
+            adc.w   R13                           ; (1) (izbaceni bit se vraca na najnizu poziciju)
+            mov.w   R13, &entropy_adc             ; (4)
+            rra.w   R12                           ; (1) Deljenje zbira sa 8 (zbir je manji od 8000h,
+            rra.w   R12                           ; (1) pa je aritmeticko pomeranje isto sto i logicko)
+            rra.w   R12                           ; (1)
+            mov.w   R12, &ad_result               ; (4) Usrednjen 12-bitni rezultat
+            mov.w   &ad_symbol, R13               ; (3) Prethodni simbol, za histerezis
+            call    #ADC_symbol_map               ; (4) R12 = ADC_symbol_map(ad_result, ad_symbol)
+            mov.w   R12, &ad_symbol               ; (4)
+adc_exit    PROFILE_END	PROFILE_SITE_ADC12
+            pop.w   R15                           ; (2) Vracanje registara R12-R15
+            pop.w   R14                           ; (2)
+            pop.w   R13                           ; (2)
+            pop.w   R12                           ; (2)
+            reti                                  ; (5)
 
 ; Vektori
 			.sect	.int54
@@ -49,3 +123,5 @@ adc_exit    pop.w   R9                            ; Vracanje registara R8 i R9
 
 			.sect	.int55
 			.short	ADC12ISR
+
+	.endif
@@ -0,0 +1,110 @@
+#include "combination.h"
+#include "candidates.h"
+#include "solver.h"
+
+#if SOLVER_ENABLED
+
+static uint16_t candidates_bits[CANDIDATES_WORDS];
+
+// pomera kombinaciju za steps mesta unapred (sabiranje u osnovi COMBINATION_SYMBOLS, bez deljenja)
+static combination_t combination_advance(combination_t combination, unsigned int steps){
+    unsigned int position;
+
+    for(position = 0; position < COMBINATION_LENGTH && steps != 0; position++){
+        unsigned int shift = position * COMBINATION_SYMBOL_BITS;
+        unsigned int digit = (unsigned int)COMBINATION_SYMBOL(combination, position) - 1 + steps;
+
+        steps = 0;
+        while(digit >= COMBINATION_SYMBOLS){
+            digit -= COMBINATION_SYMBOLS;
+            steps++;
+        }
+        combination &= ~((combination_t)COMBINATION_SYMBOL_MASK << shift);
+        combination |= (combination_t)(digit + 1) << shift;
+    }
+    return combination;
+}
+
+// trazi prvu mogucu kombinaciju od trenutne pozicije iteratora (ukljucujuci i nju)
+static unsigned int candidates_seek(candidates_iterator *iterator){
+    while(iterator->word < CANDIDATES_WORDS){
+        uint16_t bits = candidates_bits[iterator->word];
+
+        if(iterator->mask == 1 && bits == 0){
+            iterator->word++;
+            iterator->combination = combination_advance(iterator->combination, CANDIDATES_WORD_BITS);
+            continue;
+        }
+        while(iterator->mask != 0){
+            if(bits & iterator->mask){
+                return 1;
+            }
+            iterator->mask <<= 1;
+            iterator->combination = combination_next(iterator->combination);
+        }
+        iterator->word++;
+        iterator->mask = 1;
+    }
+    return 0;
+}
+
+void candidates_reset(void){
+    unsigned int i;
+
+    for(i = 0; i < CANDIDATES_WORDS; i++){
+        candidates_bits[i] = 0xFFFF;
+    }
+#if (COMBINATION_CODE_COUNT % CANDIDATES_WORD_BITS) != 0
+    // bitovi iza poslednje kombinacije ne postoje
+    candidates_bits[CANDIDATES_WORDS - 1] = (uint16_t)((1u << (COMBINATION_CODE_COUNT % CANDIDATES_WORD_BITS)) - 1);
+#endif
+}
+
+unsigned int candidates_first(candidates_iterator *iterator){
+    iterator->word = 0;
+    iterator->mask = 1;
+    iterator->combination = COMBINATION_LSB_MASK;
+    return candidates_seek(iterator);
+}
+
+unsigned int candidates_next(candidates_iterator *iterator){
+    iterator->mask <<= 1;
+    iterator->combination = combination_next(iterator->combination);
+    if(iterator->mask == 0){
+        iterator->word++;
+        iterator->mask = 1;
+    }
+    return candidates_seek(iterator);
+}
+
+unsigned int candidates_prune(combination_t guess, unsigned int result){
+    candidates_iterator iterator;
+    unsigned int kept = 0;
+    unsigned int more;
+
+    for(more = candidates_first(&iterator); more; more = candidates_next(&iterator)){
+        if(combination_check(guess, iterator.combination) == result){
+            kept++;
+        }else{
+            candidates_bits[iterator.word] &= ~iterator.mask;
+        }
+    }
+    return kept;
+}
+
+unsigned int candidates_count(void){
+    unsigned int i;
+    unsigned int count = 0;
+
+    for(i = 0; i < CANDIDATES_WORDS; i++){
+        uint16_t bits = candidates_bits[i];
+
+        bits = bits - ((bits >> 1) & 0x5555);
+        bits = (bits & 0x3333) + ((bits >> 2) & 0x3333);
+        bits = (bits + (bits >> 4)) & 0x0F0F;
+        count += (bits + (bits >> 8)) & 0x1F;
+    }
+    return count;
+}
+
+#endif /* SOLVER_ENABLED */
@@ -0,0 +1,110 @@
+#ifndef CANDIDATES_H_
+#define CANDIDATES_H_
+/**
+ * @brief Skup jos mogucih kombinacija (bitset)
+ *
+ * Resavac prati koje kombinacije su jos konzistentne sa svim pokusajima iz trenutne
+ * igre. Svaka kombinacija ima svoj bit: bit i odgovara i-toj kombinaciji redom kojim
+ * ih daje combination_next od 11..1 (za 4 x 6: 1111, 1112, ..., 1116, 1121, ..., 6666).
+ * Za 1296 kombinacija skup zauzima 81 rec, tj. 162 bajta RAM-a, umesto 2592 bajta
+ * za listu upakovanih kombinacija.
+ *
+ * Kombinacija se iz indeksa bita ne racuna deljenjem: iterator se pomera zajedno sa
+ * bitom (combination_next), a preko prazne reci preskace 16 kombinacija odjednom.
+ *
+ * Cena jednog prolaza candidates_prune u ciklusima MCLK (vremena su data za podrazumevanih
+ * CLOCK_MCLK_HZ ~16 MHz, clock.h):
+ * - po mogucoj kombinaciji: combination_check, test i brisanje bita i pomeranje
+ *   iteratora, oko 200 ciklusa (kao i u SOLVER_CHECK_BUDGET)
+ * - po nemogucoj kombinaciji u nepraznoj reci: oko 15 ciklusa
+ * - po praznoj reci: oko 60 ciklusa (preskakanje 16 kombinacija)
+ * Posle prvog pokusaja (1296 mogucih) prolaz traje oko 260 000 ciklusa (~16 ms).
+ * Posle 1122 ostaje najvise 256 mogucih, pa je sledeci prolaz oko 70 000 ciklusa
+ * (~4.4 ms), a dalje je prolaz odredjen uglavnom praznim recima (~5 000 ciklusa).
+ * Merenje na ploci: PROFILE_SITE_HINT obuhvata solver_hint, a prolaz se poziva iz
+ * stanja PROCESS_SYMBOL (PROFILE_SITE_STATE).
+ *
+ */
+#include <stdint.h>
+
+#include "combination.h"
+
+#define CANDIDATES_WORD_BITS    (16)
+#define CANDIDATES_WORDS        ((unsigned int)((COMBINATION_CODE_COUNT + CANDIDATES_WORD_BITS - 1) / CANDIDATES_WORD_BITS))
+/**
+ * @brief Iterator kroz moguce kombinacije
+ *
+ * - word        -> indeks reci u skupu
+ * - mask        -> bit trenutne kombinacije u reci
+ * - combination -> trenutna kombinacija (upakovana)
+ *
+ */
+typedef struct{
+    unsigned int word;
+    uint16_t mask;
+    combination_t combination;
+} candidates_iterator;
+/**
+ * @brief Funkcija candidates_reset
+ *
+ * - opis:
+ *      Funkcija postavlja sve bitove: na pocetku igre su moguce sve kombinacije.
+ *
+ * - argumenti:
+ *      nema
+ *
+ * - povratna vrednost:
+ *      nema
+ *
+ */
+extern void candidates_reset(void);
+/**
+ * @brief Funkcija candidates_prune
+ *
+ * - opis:
+ *      Funkcija brise kombinacije koje za pokusaj guess ne bi dale rezultat result
+ *      (combination_check). Jedan prolaz kroz skup; cena je opisana iznad.
+ *
+ * - argumenti:
+ *      - guess  - upakovan pokusaj
+ *      - result - upakovan rezultat koji je pokusaj dobio
+ *
+ * - povratna vrednost:
+ *      Broj kombinacija koje su ostale moguce.
+ *
+ */
+extern unsigned int candidates_prune(combination_t guess, unsigned int result);
+/**
+ * @brief Funkcija candidates_count
+ *
+ * - opis:
+ *      Funkcija broji postavljene bitove (SWAR popcount po reci, bez tabele i petlje
+ *      po bitovima), oko 25 ciklusa po reci.
+ *
+ * - argumenti:
+ *      nema
+ *
+ * - povratna vrednost:
+ *      Broj mogucih kombinacija.
+ *
+ */
+extern unsigned int candidates_count(void);
+/**
+ * @brief Funkcije candidates_first i candidates_next
+ *
+ * - opis:
+ *      candidates_first postavlja iterator na prvu mogucu kombinaciju, a candidates_next
+ *      na sledecu. Trenutna kombinacija je u iterator->combination. Bit trenutne
+ *      kombinacije sme da se obrise u toku iteracije.
+ *
+ * - argumenti:
+ *      - iterator - iterator koji se pomera
+ *
+ * - povratna vrednost:
+ *      1 ako iterator pokazuje na mogucu kombinaciju, 0 na kraju skupa.
+ *
+ */
+extern unsigned int candidates_first(candidates_iterator *iterator);
+extern unsigned int candidates_next(candidates_iterator *iterator);
+
+#endif /* CANDIDATES_H_ */
@@ -0,0 +1,48 @@
+#include <msp430.h>
+
+#include "clock.h"
+
+// podize napon jezgra za jedan nivo (postupak iz korisnickog uputstva, poglavlje PMM)
+static void clock_vcore_up(unsigned int level){
+    PMMCTL0_H = PMMPW_H;                // otkljucavanje PMM registara
+
+    // nadzor visokog napona (SVS/SVM) na novi nivo
+    SVSMHCTL = SVSHE | SVSHRVL0 * level | SVMHE | SVSMHRRL0 * level;
+    // nadzor niskog napona samo kao monitor na novi nivo, dok se napon ne podigne
+    SVSMLCTL = SVSLE | SVMLE | SVSMLRRL0 * level;
+    while((PMMIFG & SVSMLDLYIFG) == 0);
+    PMMIFG &= ~(SVMLVLRIFG | SVMLIFG);
+
+    PMMCTL0_L = PMMCOREV0 * level;
+    // ceka se da napon jezgra dostigne novi nivo
+    if(PMMIFG & SVMLIFG){
+        while((PMMIFG & SVMLVLRIFG) == 0);
+    }
+
+    SVSMLCTL = SVSLE | SVSLRVL0 * level | SVMLE | SVSMLRRL0 * level;
+    PMMCTL0_H = 0x00;                   // zakljucavanje PMM registara
+}
+
+void clock_init(void){
+    unsigned int level;
+
+    for(level = 1; level <= CLOCK_VCORE_LEVEL; level++){
+        clock_vcore_up(level);
+    }
+
+    UCSCTL3 = SELREF__REFOCLK;          // referenca FLL je REFO, pa ne zavisi od kristala XT1
+
+    __bis_SR_register(SCG0);            // FLL se iskljucuje dok se menja opseg
+    UCSCTL0 = 0;                        // najnizi DCOx i MODx, FLL ih podesava
+    UCSCTL1 = CLOCK_DCORSEL;
+    UCSCTL2 = FLLD_1 | CLOCK_FLLN;      // DCOCLK = 2 * DCOCLKDIV, DCOCLKDIV = (FLLN + 1) * REFO
+    __bic_SR_register(SCG0);
+
+    __delay_cycles(CLOCK_FLL_SETTLE_CYCLES);
+
+    // MCLK i SMCLK su vec DCOCLKDIV (podrazumevano), ceka se da nestane greska DCO
+    do{
+        UCSCTL7 &= ~DCOFFG;
+        SFRIFG1 &= ~OFIFG;
+    }while(UCSCTL7 & DCOFFG);
+}
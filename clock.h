@@ -0,0 +1,123 @@
+#ifndef CLOCK_H_
+#define CLOCK_H_
+/**
+ * @brief Takt procesora (UCS)
+ *
+ * MCLK i SMCLK se dobijaju iz DCO (DCOCLKDIV), koji FLL drzi na umnosku referentnog
+ * takta REFO od 32768 Hz: f = (FLLN + 1) * 32768 Hz. Zeljena ucestanost se zadaje pri
+ * prevodjenju (--define=CLOCK_MCLK_TARGET_HZ=...), najvise 25 MHz za MSP430F5438A,
+ * a stvarna ucestanost CLOCK_MCLK_HZ je najblizi manji umnozak od 32768 Hz.
+ * ACLK (tajmer TA0, vremenske oznake, debounce) ostaje 32768 Hz, a AD konvertor koristi
+ * svoj oscilator (ADC12OSC), pa se te periode ne menjaju sa MCLK.
+ *
+ * Napon jezgra (PMMCOREV) se podize pre povecanja ucestanosti, po opsezima iz datasheet-a:
+ * do 8 MHz nivo 0, do 12 MHz nivo 1, do 20 MHz nivo 2, do 25 MHz nivo 3.
+ *
+ */
+#ifndef CLOCK_MCLK_TARGET_HZ
+#define CLOCK_MCLK_TARGET_HZ    (16000000UL)
+#endif
+
+#define CLOCK_REFERENCE_HZ      (32768UL)
+#define CLOCK_FLLN              (CLOCK_MCLK_TARGET_HZ / CLOCK_REFERENCE_HZ - 1)
+#define CLOCK_MCLK_HZ           ((CLOCK_FLLN + 1) * CLOCK_REFERENCE_HZ)
+
+#if CLOCK_MCLK_TARGET_HZ > 25000000UL
+#error "CLOCK_MCLK_TARGET_HZ: MSP430F5438A radi najvise na 25 MHz"
+#elif CLOCK_MCLK_TARGET_HZ < CLOCK_REFERENCE_HZ * 32
+#error "CLOCK_MCLK_TARGET_HZ: FLL ne moze ispod 1 MHz"
+#endif
+
+#if CLOCK_MCLK_HZ <= 8000000UL
+#define CLOCK_VCORE_LEVEL       (0)
+#elif CLOCK_MCLK_HZ <= 12000000UL
+#define CLOCK_VCORE_LEVEL       (1)
+#elif CLOCK_MCLK_HZ <= 20000000UL
+#define CLOCK_VCORE_LEVEL       (2)
+#else
+#define CLOCK_VCORE_LEVEL       (3)
+#endif
+
+// opseg DCO za DCOCLK = 2 * MCLK (FLLD = /2)
+#if CLOCK_MCLK_HZ <= 4000000UL
+#define CLOCK_DCORSEL           (DCORSEL_3)
+#elif CLOCK_MCLK_HZ <= 8000000UL
+#define CLOCK_DCORSEL           (DCORSEL_4)
+#elif CLOCK_MCLK_HZ <= 16000000UL
+#define CLOCK_DCORSEL           (DCORSEL_5)
+#else
+#define CLOCK_DCORSEL           (DCORSEL_6)
+#endif
+
+// najduze smirivanje FLL: 32 * 32 perioda reference, izrazeno u ciklusima MCLK
+#define CLOCK_FLL_SETTLE_CYCLES (32UL * 32UL * (CLOCK_FLLN + 1))
+/**
+ * @brief Brzina serijske veze (USCI_A0)
+ *
+ * Brzina se zadaje pri prevodjenju (--define=UART_BAUD=57600, 115200 ili 230400), a
+ * delioci se racunaju iz CLOCK_MCLK_HZ (SMCLK) po postupku iz korisnickog uputstva:
+ * - N = SMCLK / UART_BAUD >= 16 -> oversampling (UCOS16): UCBRx = N / 16, UCBRFx = N % 16,
+ *                                  gde je N zaokruzeno na ceo broj
+ * - N < 16                      -> niskofrekventni mod: UCBRx = N, UCBRSx = razlomljeni deo * 8
+ * Procena najvece greske po bitu (u promilima) je odstupanje srednje brzine, uvecano u
+ * niskofrekventnom modu za pola periode BRCLK (500 / N), jer modulacija UCBRSx pomera
+ * ivice bita za najvise toliko. Ako je procena veca od UART_BAUD_ERROR_MAX_PERMILLE,
+ * prevodjenje se prekida.
+ *
+ */
+#ifndef UART_BAUD
+#define UART_BAUD               (115200UL)
+#endif
+#ifndef UART_BAUD_ERROR_MAX_PERMILLE
+#define UART_BAUD_ERROR_MAX_PERMILLE    (20)
+#endif
+
+#define UART_N                  ((CLOCK_MCLK_HZ + UART_BAUD / 2) / UART_BAUD)
+
+#if UART_N >= 16
+#define UART_UCOS16             (1)
+#define UART_UCBRW              (UART_N / 16)
+#define UART_UCBRF              (UART_N % 16)
+#define UART_UCBRS              (0)
+#define UART_DIVISOR_X16        (UART_N * 16)
+#define UART_MODULATION_PERMILLE    (0)
+#else
+#define UART_N_X8               ((CLOCK_MCLK_HZ * 8 + UART_BAUD / 2) / UART_BAUD)
+#define UART_UCOS16             (0)
+#define UART_UCBRW              (UART_N_X8 / 8)
+#define UART_UCBRF              (0)
+#define UART_UCBRS              (UART_N_X8 % 8)
+#define UART_DIVISOR_X16        (UART_N_X8 * 2)
+#define UART_MODULATION_PERMILLE    (500 / UART_N)
+#endif
+
+#if UART_UCBRW < 1 || UART_N < 3
+#error "UART_BAUD: brzina je prevelika za CLOCK_MCLK_HZ"
+#endif
+
+// stvarna brzina je CLOCK_MCLK_HZ * 16 / UART_DIVISOR_X16 (samo za #if, zbog 64-bitne aritmetike)
+#if (CLOCK_MCLK_HZ * 16 * 1000 > UART_BAUD * UART_DIVISOR_X16 * (1000 + UART_BAUD_ERROR_MAX_PERMILLE - UART_MODULATION_PERMILLE)) || \
+    (CLOCK_MCLK_HZ * 16 * 1000 < UART_BAUD * UART_DIVISOR_X16 * (1000 - UART_BAUD_ERROR_MAX_PERMILLE + UART_MODULATION_PERMILLE)) || \
+    (UART_MODULATION_PERMILLE > UART_BAUD_ERROR_MAX_PERMILLE)
+#error "UART_BAUD: greska brzine je veca od UART_BAUD_ERROR_MAX_PERMILLE za CLOCK_MCLK_HZ"
+#endif
+
+#define UART_UCA0MCTL           (UART_UCBRS * UCBRS0 | UART_UCBRF * UCBRF0 | (UART_UCOS16 ? UCOS16 : 0))
+/**
+ * @brief Funkcija clock_init
+ *
+ * - opis:
+ *      Funkcija podize napon jezgra na CLOCK_VCORE_LEVEL, podesava FLL tako da MCLK i SMCLK
+ *      budu CLOCK_MCLK_HZ i ceka da se DCO smiri. Poziva se na pocetku main-a, pre
+ *      inicijalizacije UART-a.
+ *
+ * - argumenti:
+ *      nema
+ *
+ * - povratna vrednost:
+ *      nema
+ *
+ */
+extern void clock_init(void);
+
+#endif /* CLOCK_H_ */
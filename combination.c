@@ -1,10 +1,10 @@
-#include <msp430.h>
-#include <stdlib.h>
+#include "hal.h"
 #include <stdint.h>
-#include <time.h>
-#include <math.h>
+#include <string.h>
 
 #include "combination.h"
+#include "entropy.h"
+#include "uart_tx.h"
 
 // mapa kodovanih izlaza za LED displej
 const unsigned int seven_segment_display_table[] = {
@@ -19,161 +19,268 @@ const unsigned int seven_segment_display_table[] = {
         0x7f, // abcdefg kodovan izlaz na segmosegmentni displej za broj 8
         0x7b // abcdefg kodovan izlaz na segmosegmentni displej za broj 9
 };
+/**
+ * @brief Bafer LED displeja
+ *
+ * Za svaki od 4 displeja cuva se vec kodovan izlaz (abcdefg), pozicija 0 je displej prvi sleva.
+ * Prekidna rutina tajmera CCR0ISR (ISR.asm) u svakoj periodi tajmera ispisuje sledeci displej
+ * iz bafera, pa se sva 4 displeja osvezavaju stalno i istom ucestanoscu.
+ *
+ */
+volatile unsigned char display_framebuffer[DISPLAY_DIGITS] = {0x7E, 0x7E, 0x7E, 0x7E};
+
+/**
+ * @brief Sabloni poruka koje se salju preko serijske veze
+ *
+ * Poruke se cuvaju kao konstantni stringovi u flash memoriji. Pri slanju se sablon
+ * kopira u kruzni bafer za slanje (uart_tx.c), a pre toga se u kopiji na steku
+ * upisuju samo cifre na predvidjenim pozicijama (STEP_*_SLOT i FINAL_*_SLOT).
+ * Polje za kombinaciju (COMBINATION_ZEROS) ima COMBINATION_LENGTH cifara, a polje za broj
+ * mogucih kombinacija (COUNT_ZEROS) COUNT_DIGITS cifara, koliko ima COMBINATION_CODE_COUNT
+ * (najmanje 4), pa se pozicije iza njih racunaju u odnosu na te duzine.
+ *
+ */
+static const char new_game_message[] = "New game [n]+[S3]\n";
+#if COMBINATION_LENGTH == 2
+#define COMBINATION_ZEROS           "00"
+#elif COMBINATION_LENGTH == 3
+#define COMBINATION_ZEROS           "000"
+#elif COMBINATION_LENGTH == 4
+#define COMBINATION_ZEROS           "0000"
+#elif COMBINATION_LENGTH == 5
+#define COMBINATION_ZEROS           "00000"
+#elif COMBINATION_LENGTH == 6
+#define COMBINATION_ZEROS           "000000"
+#else
+#define COMBINATION_ZEROS           "0000000"
+#endif
+
+#if COMBINATION_CODE_COUNT < 10000
+#define COUNT_DIGITS                (4)
+#define COUNT_ZEROS                 "0000"
+#elif COMBINATION_CODE_COUNT < 100000
+#define COUNT_DIGITS                (5)
+#define COUNT_ZEROS                 "00000"
+#elif COMBINATION_CODE_COUNT < 1000000
+#define COUNT_DIGITS                (6)
+#define COUNT_ZEROS                 "000000"
+#else
+#define COUNT_DIGITS                (7)
+#define COUNT_ZEROS                 "0000000"
+#endif
+
+static const char step_results_message[] = COMBINATION_ZEROS " S:0 WP:0 #0\n";
+static const char final_win_message[] = "Congrats!\n";
+static const char final_loss_message[] = "Bad luck!\n";
+static const char final_combination_message[] = "Combination: " COMBINATION_ZEROS "\n";
+static const char hint_message[] = "Hint: " COMBINATION_ZEROS " C:" COUNT_ZEROS " T:0000ms\n";
+static const char power_message[] = "Active:000000ms Sleep:000000ms\n";
+static const char stats_message[] = "Games:00000 Won:00000 #0 C:" COUNT_ZEROS " L:0000ms D:000\n";
+static const char command_error_message[] = "Bad command\n";
+
+#define MESSAGE_LENGTH(message)     (sizeof(message) - 1)
+
+#define STEP_COMBINATION_SLOT       (0)
+#define STEP_SCORED_SLOT            (COMBINATION_LENGTH + 3)
+#define STEP_WRONG_PLACE_SLOT       (COMBINATION_LENGTH + 8)
+#define STEP_ATTEMPT_SLOT           (COMBINATION_LENGTH + 11)
+#define FINAL_COMBINATION_SLOT      (13)
+#define HINT_COMBINATION_SLOT       (6)
+#define HINT_REMAINING_SLOT         (COMBINATION_LENGTH + 9)
+#define HINT_TIME_SLOT              (COMBINATION_LENGTH + COUNT_DIGITS + 12)
+#define POWER_ACTIVE_SLOT           (7)
+#define POWER_SLEEP_SLOT            (22)
+#define STATS_GAMES_SLOT            (6)
+#define STATS_WON_SLOT              (16)
+#define STATS_ATTEMPT_SLOT          (23)
+#define STATS_REMAINING_SLOT        (27)
+#define STATS_LATENCY_SLOT          (COUNT_DIGITS + 30)
+#define STATS_DROPPED_SLOT          (COUNT_DIGITS + 39)
 
 /**
  * @brief Funkcija new_game_print
  *
  * - opis:
- *      Funkcija ispisuje poruku nakon aplikacije.
+ *      Funkcija salje poruku nakon pokretanja aplikacije.
  *      Poruka je sledeca 'New game [n]+[S3]\n'.
  *      Poruka oznacava da treba pritisnuti slovo 'n' i kliknuti taster S3.
  *
  * - argumenti:
- *      - string_length - duzina poruke koja se ispisuje na pocetku igre
+ *      nema
  *
  * - povratna vrednost:
- *      Dekrementirana duzina poruke.
+ *      1 ako je poruka upisana u bafer za slanje, 0 ako nema mesta.
+ *
+ */
+unsigned int new_game_print(void){
+    return uart_tx_write(new_game_message, MESSAGE_LENGTH(new_game_message));
+}
+/**
+ * @brief Stanje generatora pseudoslucajnih brojeva
+ *
+ * Koristi se 16-bitni xorshift generator (pomeraji 7, 9, 8) sa periodom 2^16 - 1.
+ * Stanje nikada ne sme biti 0, jer bi tada generator stalno vracao 0.
+ *
+ */
+static uint16_t prng_state = 0xACE1;
+/**
+ * @brief Ponovljive igre
+ *
+ * Promenljiva prng_fixed oznacava da je stanje generatora zadato komandom "s <broj>"
+ * (combination_seed_set). Tada combination_generate ne umesava entropiju, pa isti broj
+ * uvek daje isti niz igara.
  *
  */
-unsigned int new_game_print(unsigned int string_length){
-    unsigned int length = string_length;
+static unsigned int prng_fixed = 0;
+/**
+ * @brief Funkcija prng_next
+ *
+ * - opis:
+ *      Funkcija racuna sledeci pseudoslucajan broj samo pomeranjima i XOR-om,
+ *      bez mnozenja, deljenja i rada sa pokretnim zarezom.
+ *
+ */
+static uint16_t prng_next(void){
+    uint16_t x = prng_state;
 
-    switch(length){
-        case 18:
-            UCA0TXBUF = 78; // 'N'
-            length--;
-            break;
-        case 17:
-            UCA0TXBUF = 101; // 'e'
-            length--;
-            break;
-        case 16:
-            UCA0TXBUF = 119; // 'w'
-            length--;
-            break;
-        case 15:
-            UCA0TXBUF = 32; // ' '
-            length--;
-            break;
-        case 14:
-            UCA0TXBUF = 103; // 'g'
-            length--;
-            break;
-        case 13:
-            UCA0TXBUF = 97; // 'a'
-            length--;
-            break;
-        case 12:
-            UCA0TXBUF = 109; // 'm'
-            length--;
-            break;
-        case 11:
-            UCA0TXBUF = 101; // 'e'
-            length--;
-            break;
-        case 10:
-            UCA0TXBUF = 32; // ' '
-            length--;
-            break;
-        case 9:
-            UCA0TXBUF = 91; // '['
-            length--;
-            break;
-        case 8:
-            UCA0TXBUF = 110; // 'n'
-            length--;
-            break;
-        case 7:
-            UCA0TXBUF = 93; // ']'
-            length--;
-            break;
-        case 6:
-            UCA0TXBUF = 43; // '+'
-            length--;
-            break;
-        case 5:
-            UCA0TXBUF = 91; // '['
-            length--;
-            break;
-        case 4:
-            UCA0TXBUF = 83; // 'S'
-            length--;
-            break;
-        case 3:
-            UCA0TXBUF = 51; // '3'
-            length--;
-            break;
-        case 2:
-            UCA0TXBUF = 93; // ']'
-            length--;
-            break;
-        case 1:
-            UCA0TXBUF = '\n';
-            length--;
-            break;
-        default:
-            break;
+    x ^= x << 7;
+    x ^= x >> 9;
+    x ^= x << 8;
+    prng_state = x;
+
+    return x;
+}
+/**
+ * @brief Funkcija combination_seed
+ *
+ * - opis:
+ *      Funkcija mesa novu vrednost u stanje generatora pseudoslucajnih brojeva.
+ *
+ * - argumenti:
+ *      - seed - vrednost koja se umesava u stanje (npr. vremenska oznaka klika na taster)
+ *
+ * - povratna vrednost:
+ *      nema
+ *
+ */
+void combination_seed(unsigned int seed){
+    prng_state ^= (uint16_t)seed;
+    if(prng_state == 0){
+        prng_state = 0xACE1;
+    }
+    prng_next();
+}
+/**
+ * @brief Funkcija combination_seed_set
+ *
+ * - opis:
+ *      Funkcija postavlja stanje generatora pseudoslucajnih brojeva na zadatu vrednost
+ *      i iskljucuje umesavanje entropije, pa su sledece igre ponovljive. Vrednost 0
+ *      ponovo ukljucuje umesavanje entropije (slucajne igre).
+ *
+ * - argumenti:
+ *      - seed - novo stanje generatora, ili 0
+ *
+ * - povratna vrednost:
+ *      nema
+ *
+ */
+void combination_seed_set(unsigned int seed){
+    if(seed == 0){
+        prng_fixed = 0;
+        return;
     }
-    return length;
+    prng_state = (uint16_t)seed;
+    prng_fixed = 1;
 }
 /**
  * @brief Funkcija combination_generate
  *
  * - opis:
  *      Funkcija nasumicno generise kombinaciju koju treba pogoditi
- *      u toku jedne igre. Kombinacija je cetvorocifreni broj kod kojeg
- *      svaka cifra pripada skupu {1,2,3,4,5,6}.
+ *      u toku jedne igre. Kombinacija se sastoji od COMBINATION_LENGTH simbola iz skupa
+ *      {1,...,COMBINATION_SYMBOLS} (podrazumevano 4 simbola iz {1,2,3,4,5,6}),
+ *      upakovanih po 4 bita (vidi COMBINATION_SYMBOL).
+ *      Svaki simbol se dobija iz 3 bita pseudoslucajnog broja; vrednosti od COMBINATION_SYMBOLS
+ *      do 7 se odbacuju (za 6 simbola to su 6 i 7), pa je raspodela ravnomerna, bez deljenja po modulu.
+ *      Pre generisanja se u generator umesava skup entropije (entropy.c), koji prekidne
+ *      rutine pune u pozadini, osim ako je stanje zadato funkcijom combination_seed_set.
  *
  * - argumenti:
  *      nema
  *
  * - povratna vrednost:
- *      Nasumicno generisana kombinacija, npr: 1165.
+ *      Nasumicno generisana kombinacija, npr: 0x1165.
  *
  */
-unsigned int combination_generate(void){
-    int i;
-    int combination = 0;
-    int number = 0;
-
-    srand(time(NULL));
-    for(i=3; i>=0; i--){
-        // nasucimcno generisan broj u opsegu od [1,6];
-        number = rand() % 6 + 1;
-
-        // upakovavanje tog broja u kombinaciju
-        combination += number*pow(10,i);
+combination_t combination_generate(void){
+    unsigned int i;
+    combination_t combination = 0;
+    unsigned int number = 0;
+
+    // umesavanje trenutnog sadrzaja skupa entropije (ne blokira)
+    if(!prng_fixed){
+        combination_seed(entropy_take());
+    }
+
+    for(i=0; i<COMBINATION_LENGTH; i++){
+        // nasucimcno generisan broj u opsegu od [1,COMBINATION_SYMBOLS], odbacivanjem vecih vrednosti
+        do{
+            number = prng_next() >> 13;
+        }while(number >= COMBINATION_SYMBOLS);
+
+        // upakovavanje tog broja u kombinaciju, svaki simbol zauzima 4 bita
+        combination = (combination << COMBINATION_SYMBOL_BITS) | (number + 1);
     }
     return combination;
 }
+/**
+ * @brief Granice simbola za AD konverziju
+ *
+ * Gornje (iskljucive) granice usrednjenog 12-bitnog rezultata AD konverzije za
+ * simbole 1 do COMBINATION_SYMBOLS - 1; sve iznad poslednje granice je poslednji simbol.
+ * Za 6 simbola granice odgovaraju ranijem mapiranju 4 najvisa bita rezultata
+ * (0-2, 3-5, 6-8, 9-11, 12-13, 14-15), a za ostale konfiguracije opseg se deli ravnomerno.
+ *
+ */
+#if COMBINATION_SYMBOLS == 6
+static const unsigned int adc_symbol_threshold[COMBINATION_SYMBOLS - 1] = {768, 1536, 2304, 3072, 3584};
+#else
+#define ADC_SYMBOL_THRESHOLD(k)     ((unsigned int)((k) * 4096UL / COMBINATION_SYMBOLS))
+static const unsigned int adc_symbol_threshold[8 - 1] = {
+        ADC_SYMBOL_THRESHOLD(1), ADC_SYMBOL_THRESHOLD(2), ADC_SYMBOL_THRESHOLD(3), ADC_SYMBOL_THRESHOLD(4),
+        ADC_SYMBOL_THRESHOLD(5), ADC_SYMBOL_THRESHOLD(6), ADC_SYMBOL_THRESHOLD(7)
+};
+#endif
 /**
  * @brief Funkcija ADC_symbol_map
  *
  * - opis:
- *      Funkcija mapira vrednosti iz opsega [0;15] na opseg [1;6].
+ *      Funkcija mapira usrednjen rezultat AD konverzije na opseg [1;COMBINATION_SYMBOLS], uz histerezis.
+ *      Dok je rezultat unutar opsega prethodnog simbola prosirenog za ADC_HYSTERESIS
+ *      sa obe strane, zadrzava se prethodni simbol, pa sum potenciometra na samoj
+ *      granici ne menja izabran simbol. Poziva se iz prekidne rutine AD konvertora (ISR.asm).
  *
  * - argumenti:
- *      - ad_result - vrednost dobijena AD konverzijom iz opsega [0;15]
+ *      - ad_average - usrednjen rezultat AD konverzije iz opsega [0;4095]
+ *      - symbol - prethodno izabran simbol (vrednost van [1;COMBINATION_SYMBOLS] iskljucuje histerezis)
  *
  * - povratna vrednost:
- *      Premapiran simbol na opseg [1;6].
+ *      Premapiran simbol na opseg [1;COMBINATION_SYMBOLS].
  *
  */
-unsigned int ADC_symbol_map(unsigned int ad_result){
-    unsigned int current_symbol = 0;
-
-    if(ad_result >= 0 && ad_result <= 2){
-        current_symbol = 1;
-    }else if(ad_result >= 3 && ad_result <= 5){
-        current_symbol = 2;
-    }else if(ad_result >= 6 && ad_result <= 8){
-        current_symbol = 3;
-    }else if(ad_result >= 9 && ad_result <= 11){
-        current_symbol = 4;
-    }else if(ad_result >= 12 && ad_result <= 13){
-        current_symbol = 5;
-    }else if(ad_result >= 14 && ad_result <= 15){
-        current_symbol = 6;
+unsigned int ADC_symbol_map(unsigned int ad_average, unsigned int symbol){
+    unsigned int current_symbol = 1;
+
+    if(symbol >= 1 && symbol <= COMBINATION_SYMBOLS){
+        if((symbol == 1 || ad_average + ADC_HYSTERESIS >= adc_symbol_threshold[symbol - 2]) &&
+           (symbol == COMBINATION_SYMBOLS || ad_average < adc_symbol_threshold[symbol - 1] + ADC_HYSTERESIS)){
+            return symbol;
+        }
+    }
+
+    while(current_symbol < COMBINATION_SYMBOLS && ad_average >= adc_symbol_threshold[current_symbol - 1]){
+        current_symbol++;
     }
     return current_symbol;
 }
@@ -188,33 +295,41 @@ unsigned int ADC_symbol_map(unsigned int ad_result){
  *      - symbol - izabran simbol
  *
  * - povratna vrednost:
- *      Vrednost koju treba dodati na trenutnu kombinaciju.
+ *      Vrednost koju treba dodati (ili OR-ovati) na trenutnu upakovanu kombinaciju.
  *
  */
-unsigned int symbol_push(unsigned int index, unsigned int symbol){
-    unsigned int combination_part = 0;
+combination_t symbol_push(unsigned int index, unsigned int symbol){
+    combination_t combination_part = 0;
 
+#if COMBINATION_LENGTH == 4
     switch(index){
         case 4:
-            combination_part = symbol*1000;
+            combination_part = symbol << 12;
             break;
         case 3:
-            combination_part = symbol*100;
+            combination_part = symbol << 8;
             break;
         case 2:
-            combination_part = symbol*10;
+            combination_part = symbol << 4;
             break;
         case 1:
             combination_part = symbol;
             break;
     }
+#else
+    if(index >= 1 && index <= COMBINATION_LENGTH){
+        combination_part = (combination_t)symbol << ((index - 1) * COMBINATION_SYMBOL_BITS);
+    }
+#endif
     return combination_part;
 }
 /**
  * @brief Funkcija LED_display_print
  *
  * - opis:
- *      Funkcija ispisuje na LED displej izabran simbol.
+ *      Funkcija upisuje izabran simbol u bafer LED displeja (display_framebuffer).
+ *      Sam ispis, odnosno multipleksiranje displeja, radi prekidna rutina tajmera
+ *      CCR0ISR (ISR.asm), pa glavni program ne mora da "vodi" displej.
  *
  * - argumenti:
  *      - LED_display_index - redni broj sedmosegmentnog displeja na koji treba da se ispise broj
@@ -228,93 +343,86 @@ unsigned int LED_display_print(unsigned int LED_display_index, unsigned int symb
 {
     unsigned int display_index = LED_display_index;
 
-    switch(display_index){
-        case 4:
-            P11OUT |= BIT0;
-            P10OUT |= BIT7|BIT6;
-
-            P6OUT = seven_segment_display_table[symbol];
-            P11OUT &= ~BIT1;
-
-            display_index--;
-            break;
-        case 3:
-            P11OUT |= BIT1;
-            P10OUT |= BIT7|BIT6;
-
-            P6OUT = seven_segment_display_table[symbol];
-            P11OUT &= ~BIT0;
-
-            display_index--;
-            break;
-        case 2:
-            P11OUT |= BIT1|BIT0;
-            P10OUT |= BIT6;
-
-            P6OUT = seven_segment_display_table[symbol];
-            P10OUT &= ~BIT7;
-
-            display_index--;
-            break;
-        case 1:
-            P11OUT |= BIT1|BIT0;
-            P10OUT |= BIT7;
-
-            P6OUT = seven_segment_display_table[symbol];
-            P10OUT &= ~BIT6;
+#if COMBINATION_LENGTH <= DISPLAY_DIGITS
+    if(display_index >= 1 && display_index <= DISPLAY_DIGITS){
+        // displej 4 je prvi sleva, a u baferu je na poziciji 0
+        display_framebuffer[DISPLAY_DIGITS - display_index] = (unsigned char)seven_segment_display_table[symbol];
+        display_index--;
+    }
+#else
+    unsigned int i;
 
-            display_index--;
-            break;
-        default:
-            break;
+    // kombinacija je duza od broja displeja: prikaz se pomera ulevo, a novi simbol je uvek poslednji
+    if(display_index >= 1 && display_index <= COMBINATION_LENGTH){
+        for(i = 0; i < DISPLAY_DIGITS - 1; i++){
+            display_framebuffer[i] = display_framebuffer[i + 1];
+        }
+        display_framebuffer[DISPLAY_DIGITS - 1] = (unsigned char)seven_segment_display_table[symbol];
+        display_index--;
     }
+#endif
 
     return display_index;
+}
+/**
+ * @brief Funkcija display_clear
+ *
+ * - opis:
+ *      Funkcija upisuje nulu (prazno mesto) na sva 4 LED displeja.
+ *
+ * - argumenti:
+ *      nema
+ *
+ * - povratna vrednost:
+ *      nema
+ *
+ */
+void display_clear(void){
+    unsigned int i;
 
+    for(i = 0; i < DISPLAY_DIGITS; i++){
+        display_framebuffer[i] = (unsigned char)seven_segment_display_table[0];
+    }
 }
 /**
- * @brief Funkcija combination_check
+ * @brief Funkcija combination_check_reference
  *
  * - opis:
- *      Funkcija proverava trenutnu i pravu kombinaciju.
+ *      Referentna implementacija provere trenutne i prave kombinacije: simboli se raspakuju
+ *      u nizove, a simboli na pogresnom mestu se broje preko dva histograma.
+ *      Koristi se samo za poredjenje sa brzom implementacijom (combination_check).
  *
  * - argumenti:
  *      - combination - korisnikova izabrana kombinacija
  *      - true_combination - prava kombinacija, sa njom se vrsi poredjenje
  *
  * - povratna vrednost:
- *      Rezultat, trocifren broj, kod kojeg prva cifra sleva govori koliko skroz tacnih simbola
- *      ima, druga koliko ih ima na pogresnom mestu, a treca koliko netacnih.
+ *      Rezultat upakovan po 4 bita (RESULT_PACK), kod kojeg najvisa grupa govori koliko skroz
+ *      tacnih simbola ima, srednja koliko ih ima na pogresnom mestu, a najniza koliko netacnih.
  *
  */
-unsigned int combination_check(unsigned int combination,unsigned int true_combination)
+unsigned int combination_check_reference(combination_t combination,combination_t true_combination)
 {
     unsigned int i = 0, scored = 0, faulty = 0, wrong = 0;
 
     // rezultat provere
-    int result  = 0;
+    unsigned int result  = 0;
 
     // nizovi kombinacija
-    int comb1[4] = {0};
-    int comb2[4] = {0};
+    unsigned int comb1[COMBINATION_LENGTH] = {0};
+    unsigned int comb2[COMBINATION_LENGTH] = {0};
 
-    int help1[6] = {0};
-    int help2[6] = {0};
+    unsigned int help1[COMBINATION_SYMBOLS] = {0};
+    unsigned int help2[COMBINATION_SYMBOLS] = {0};
 
-    // otpakivanje korisnikove kombinacije i storovanje u niz
-    comb1[0] = combination / 1000;
-    comb1[1] = (combination % 1000) / 100;
-    comb1[2] = (combination % 100) / 10;
-    comb1[3] = combination % 10;
-
-    // otpakivanje generisane kombinacije i storovanje u niz
-    comb2[0] = true_combination / 1000;
-    comb2[1] = (true_combination % 1000) / 100;
-    comb2[2] = (true_combination % 100) / 10;
-    comb2[3] = true_combination % 10;
+    // otpakivanje obe kombinacije i storovanje u nizove (samo pomeranja i maske)
+    for(i=0; i<COMBINATION_LENGTH; i++){
+        comb1[i] = COMBINATION_SYMBOL(combination, COMBINATION_LENGTH - 1 - i);
+        comb2[i] = COMBINATION_SYMBOL(true_combination, COMBINATION_LENGTH - 1 - i);
+    }
 
     // prebrojavanje tacnih
-    for(i=0; i<4; i++){
+    for(i=0; i<COMBINATION_LENGTH; i++){
         if(comb1[i] == comb2[i]){
             scored++;
         }else{
@@ -324,27 +432,160 @@ unsigned int combination_check(unsigned int combination,unsigned int true_combin
     }
 
     // prebrojavanje simbola sa pogresnim mestom
-    for(i=0;i<6;i++){
+    for(i=0;i<COMBINATION_SYMBOLS;i++){
         help1[i] = (help1[i] < help2[i]) ? help1[i] : help2[i];
         faulty += help1[i];
     }
 
     // netacni simboli
-    wrong = 4 - scored - faulty;
+    wrong = COMBINATION_LENGTH - scored - faulty;
 
     // pakovanje u result
-    result = scored*100 + faulty*10 + wrong;
+    result = RESULT_PACK(scored, faulty, wrong);
 
     return result;
 }
+/**
+ * @brief Tabele za histogram simbola
+ *
+ * Histogram jedne kombinacije se cuva u dve reci, 4 bita po simbolu:
+ * simboli 1..4 su u reci "low" (simbol 1 u bitima 3..0), a simboli 5..8 u reci "high".
+ * Broj pojavljivanja simbola je najvise COMBINATION_LENGTH (manje od 8), pa je najvisi bit
+ * svakog polja uvek slobodan i koristi se kao zastitni bit pri SWAR poredjenju.
+ *
+ */
+static const unsigned int symbol_histogram_low[16] = {
+        0, 0x0001, 0x0010, 0x0100, 0x1000, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+#if COMBINATION_SYMBOLS > 4
+static const unsigned int symbol_histogram_high[16] = {
+        0, 0, 0, 0, 0, 0x0001, 0x0010, 0x0100, 0x1000, 0, 0, 0, 0, 0, 0, 0
+};
+#endif
+
+#define NIBBLE_MSB_MASK     (0x8888)
+/**
+ * @brief Funkcija nibble_sum
+ *
+ * - opis:
+ *      Sabira 4 polja od po 4 bita. Zbir sva 4 polja mora biti manji od 16.
+ *
+ */
+static inline unsigned int nibble_sum(unsigned int fields){
+    fields += fields >> 8;
+    fields += fields >> 4;
+    return fields & 0xF;
+}
+/**
+ * @brief Funkcija combination_nibble_sum
+ *
+ * - opis:
+ *      Sabira COMBINATION_LENGTH polja od po 4 bita u upakovanoj kombinaciji.
+ *      Za kombinacije do 4 pozicije ovo je upravo nibble_sum.
+ *
+ */
+static inline unsigned int combination_nibble_sum(combination_t fields){
+#if COMBINATION_LENGTH > 4
+    fields += fields >> 16;
+    return nibble_sum((unsigned int)(fields & 0xFFFF));
+#else
+    return nibble_sum(fields);
+#endif
+}
+/**
+ * @brief Funkcija symbol_histogram
+ *
+ * - opis:
+ *      Sabira polja histograma iz date tabele za sve simbole kombinacije.
+ *      Broj sabiraka je poznat pri prevodjenju, pa nema petlje.
+ *
+ */
+static inline unsigned int symbol_histogram(const unsigned int *table, combination_t combination){
+    unsigned int histogram = table[COMBINATION_SYMBOL(combination, 0)]
+                           + table[COMBINATION_SYMBOL(combination, 1)];
+#if COMBINATION_LENGTH > 2
+    histogram += table[COMBINATION_SYMBOL(combination, 2)];
+#endif
+#if COMBINATION_LENGTH > 3
+    histogram += table[COMBINATION_SYMBOL(combination, 3)];
+#endif
+#if COMBINATION_LENGTH > 4
+    histogram += table[COMBINATION_SYMBOL(combination, 4)];
+#endif
+#if COMBINATION_LENGTH > 5
+    histogram += table[COMBINATION_SYMBOL(combination, 5)];
+#endif
+#if COMBINATION_LENGTH > 6
+    histogram += table[COMBINATION_SYMBOL(combination, 6)];
+#endif
+    return histogram;
+}
+/**
+ * @brief Funkcija nibble_min
+ *
+ * - opis:
+ *      Racuna minimum za svaki par polja od po 4 bita. Vrednosti polja moraju biti manje od 8.
+ *      Zastitni bit 3 se postavi u a, pa posle oduzimanja ostaje postavljen samo
+ *      u poljima gde je a >= b. Od njega se pravi maska 0xF za ta polja i bira se b.
+ *
+ */
+static inline unsigned int nibble_min(unsigned int a, unsigned int b){
+    unsigned int greater_or_equal = ((a | NIBBLE_MSB_MASK) - b) & NIBBLE_MSB_MASK;
+    unsigned int select_b = greater_or_equal | (greater_or_equal - (greater_or_equal >> 3));
+
+    return a ^ ((a ^ b) & select_b);
+}
+/**
+ * @brief Funkcija combination_check
+ *
+ * - opis:
+ *      Funkcija proverava trenutnu i pravu kombinaciju direktno nad upakovanim kombinacijama,
+ *      bez deljenja, petlji i grananja, pa je broj ciklusa uvek isti.
+ *      - skroz tacni: XOR kombinacija je razlicit od nule samo u poljima gde se simboli
+ *        razlikuju; sva 4 bita polja se "skupe" u bit 0 i saberu se.
+ *      - histogrami: za simbole 1..4 jedna, a za simbole 5..8 druga rec (symbol_histogram);
+ *        za igru sa najvise 4 simbola druga rec je uvek nula i ne racuna se.
+ *      - ukupno poklapanje simbola: zbir minimuma histograma obe kombinacije (nibble_min).
+ *      - simboli na pogresnom mestu su razlika ukupnog poklapanja i skroz tacnih.
+ *      Rezultat je uvek isti kao kod combination_check_reference.
+ *
+ * - argumenti:
+ *      - combination - korisnikova izabrana kombinacija
+ *      - true_combination - prava kombinacija, sa njom se vrsi poredjenje
+ *
+ * - povratna vrednost:
+ *      Rezultat upakovan po 4 bita (RESULT_PACK), kod kojeg najvisa grupa govori koliko skroz
+ *      tacnih simbola ima, srednja koliko ih ima na pogresnom mestu, a najniza koliko netacnih.
+ *
+ */
+unsigned int combination_check(combination_t combination,combination_t true_combination)
+{
+    combination_t difference, mismatched;
+    unsigned int scored, matched;
+
+    // skroz tacni simboli
+    difference = combination ^ true_combination;
+    mismatched = (difference | (difference >> 1) | (difference >> 2) | (difference >> 3)) & COMBINATION_LSB_MASK;
+    scored = COMBINATION_LENGTH - combination_nibble_sum(mismatched);
+
+    // ukupan broj poklopljenih simbola, bez obzira na mesto (minimum histograma obe kombinacije)
+    matched = nibble_sum(nibble_min(symbol_histogram(symbol_histogram_low, combination),
+                                    symbol_histogram(symbol_histogram_low, true_combination)));
+#if COMBINATION_SYMBOLS > 4
+    matched += nibble_sum(nibble_min(symbol_histogram(symbol_histogram_high, combination),
+                                     symbol_histogram(symbol_histogram_high, true_combination)));
+#endif
+
+    return RESULT_PACK(scored, matched - scored, COMBINATION_LENGTH - matched);
+}
 /**
  * @brief Funkcija step_results_print
  *
  * - opis:
- *      Funkcija salje preko TX bafera i serijske veze poruku o trenutno izabranoj
+ *      Funkcija salje preko serijske veze poruku o trenutno izabranoj
  *      kombinaciji i broju pogodjenjih, broju promasenih simbola i rednom broju pokusaja.
  *      Format poruke: "xxxx S:p WP:q #r",
- *      gde je: xxxx - korisnikova kombinacija
+ *      gde je: xxxx - korisnikova kombinacija (COMBINATION_LENGTH cifara)
  *              S:p  - p je broj skroz tacno pogodnjih simbola (Scored)
  *              WP:q - q je broj simbola na pogresnom mestu (Wrong Place)
  *              #r   - r je redni broj pokusaja u jednoj igri
@@ -353,293 +594,283 @@ unsigned int combination_check(unsigned int combination,unsigned int true_combin
  *      - combination - korisnikova izabrana kombinacija
  *      - result - rezultat dobijen nakon poredjenja kombinacija
  *      - attempt_ordinal_number - redni broj pokusaja u okviru jedne igre
- *      - string_length - duzina poruke koju treba poslati
  *
  * - povratna vrednost:
- *      Dekrementira duzina poruke.
+ *      1 ako je poruka upisana u bafer za slanje, 0 ako nema mesta.
  */
-unsigned int step_results_print(unsigned int combination,unsigned int result,unsigned int attempt_ordinal_number,unsigned int string_length){
-    unsigned int length = string_length;
+unsigned int step_results_print(combination_t combination,unsigned int result,unsigned int attempt_ordinal_number){
+    char message[MESSAGE_LENGTH(step_results_message)];
 
-    switch(length){
-        case 17:
-            UCA0TXBUF = (combination / 1000) + '0' ;
-            length--;
-            break;
-        case 16:
-            UCA0TXBUF = ((combination % 1000)/100) + '0' ;
-            length--;
-            break;
-        case 15:
-            UCA0TXBUF = ((combination % 100)/10) + '0' ;
-            length--;
-            break;
-        case 14:
-            UCA0TXBUF = (combination % 10) + '0' ;
-            length--;
-            break;
-        case 13:
-            UCA0TXBUF = 32; // ' '
-            length--;
-            break;
-        case 12:
-            UCA0TXBUF = 83; // 'T'
-            length--;
-            break;
-        case 11:
-            UCA0TXBUF = 58; // ':'
-            length--;
-            break;
-        case 10:
-            UCA0TXBUF = (result / 100) + '0'; // broj tacnih
-            length--;
-            break;
-        case 9:
-            UCA0TXBUF = 32; // ' '
-            length--;
-            break;
-        case 8:
-            UCA0TXBUF = 87; // 'W'
-            length--;
-            break;
-        case 7:
-            UCA0TXBUF = 80; // 'P'
-            length--;
-            break;
-        case 6:
-            UCA0TXBUF = 58; // ':'
-            length--;
-            break;
-        case 5:
-            UCA0TXBUF = ((result % 100) / 10) + '0'; // broj pogresnih
-            length--;
-            break;
-        case 4:
-            UCA0TXBUF = 32; // ' '
-            length--;
-            break;
-        case 3:
-            UCA0TXBUF = 35; // '#'
-            length--;
-            break;
-        case 2:
-            UCA0TXBUF = attempt_ordinal_number + '0'; // redni broj pokusaja u jednoj igri
-            length--;
-            break;
-        case 1:
-            UCA0TXBUF = '\n';  // novi red
-            length--;
-            break;
-        default:
-            break;
-    }
-    return length;
+    memcpy(message, step_results_message, sizeof(message));
+
+    combination_digits_write(&message[STEP_COMBINATION_SLOT], combination);
+    message[STEP_SCORED_SLOT] = RESULT_SCORED(result) + '0';            // broj tacnih
+    message[STEP_WRONG_PLACE_SLOT] = RESULT_WRONG_PLACE(result) + '0';  // broj pogresnih
+    message[STEP_ATTEMPT_SLOT] = attempt_ordinal_number + '0';     // redni broj pokusaja u jednoj igri
+
+    return uart_tx_write(message, sizeof(message));
 }
 /**
  * @brief Funkcija final_results_print
  *
  * - opis:
- *      Funkcija salje preko TX bafera i serijske veze poruku o pravoj kombinaciji
- *      koju je trebalo pogoditi i krajnjim rezultatima igre.
+ *      Funkcija salje preko serijske veze poruku o pravoj kombinaciji
+ *      koju je trebalo pogoditi i krajnjim rezultatima igre, a zatim i poruku za novu igru.
+ *      Sve tri poruke se upisuju u bafer za slanje zajedno, ili se ne upisuje nijedna.
  *
  * - argumenti:
  *      - combination - prava kombinacija koju je trebalo pogoditi
  *      - result - rezultat dobijen nakon poredjenja kombinacija
- *      - string_length - duzina poruke koju treba poslati
  *
  * - povratna vrednost:
- *      Dekrementira duzina poruke.
+ *      1 ako je poruka upisana u bafer za slanje, 0 ako nema mesta.
  */
-unsigned int final_results_print(unsigned int combination,unsigned int result,unsigned int string_length){
-    unsigned int length = string_length;
+unsigned int final_results_print(combination_t combination,unsigned int result){
+    char message[MESSAGE_LENGTH(final_win_message) + MESSAGE_LENGTH(final_combination_message) + MESSAGE_LENGTH(new_game_message)];
+    char *position = message;
 
-    switch(length){
-        case 46:
-            UCA0TXBUF = (result == 400) ? 67 : 66; // 'C' or 'B'
-            length--;
-            break;
-        case 45:
-            UCA0TXBUF = (result == 400) ? 111 : 97; // 'o' or 'a'
-            length--;
-            break;
-        case 44:
-            UCA0TXBUF = (result == 400) ? 110 : 100; // 'n' or 'd'
-            length--;
-            break;
-        case 43:
-            UCA0TXBUF = (result == 400) ? 103 : 32; // 'g' or ' '
-            length--;
-            break;
-        case 42:
-            UCA0TXBUF = (result == 400) ? 114 : 108; // 'r' or 'l'
-            length--;
-            break;
-        case 41:
-            UCA0TXBUF = (result == 400) ? 97 : 117; // 'a' or 'u'
-            length--;
-            break;
-        case 40:
-            UCA0TXBUF = (result == 400) ? 116 : 99; // 't' or 'c'
-            length--;
-            break;
-        case 39:
-            UCA0TXBUF = (result == 400) ? 115 : 107; // 's' or 'k'
-            length--;
-            break;
-        case 38:
-            UCA0TXBUF = 33; // '!'
-            length--;
-            break;
-        case 37:
-            UCA0TXBUF = '\n';
-            length--;
-            break;
-        case 36:
-            UCA0TXBUF = 67; // 'C'
-            length--;
-            break;
-        case 35:
-            UCA0TXBUF = 111; // 'o'
-            length--;
-            break;
-        case 34:
-            UCA0TXBUF = 109; // 'm'
-            length--;
-            break;
-        case 33:
-            UCA0TXBUF = 98; // 'b'
-            length--;
-            break;
-        case 32:
-            UCA0TXBUF = 105; // 'i'
-            length--;
-            break;
-        case 31:
-            UCA0TXBUF = 110; // 'n'
-            length--;
-            break;
-        case 30:
-            UCA0TXBUF = 97; // 'a'
-            length--;
-            break;
-        case 29:
-            UCA0TXBUF = 116; // 't'
-            length--;
-            break;
-        case 28:
-            UCA0TXBUF = 105; // 'i'
-            length--;
-            break;
-        case 27:
-            UCA0TXBUF = 111; // 'o'
-            length--;
-            break;
-        case 26:
-            UCA0TXBUF = 110; // 'n'
-            length--;
-            break;
-        case 25:
-            UCA0TXBUF = 58; // ':'
-            length--;
-            break;
-        case 24:
-            UCA0TXBUF = 32; // ' '
-            length--;
-            break;
-        case 23:
-            UCA0TXBUF = (combination / 1000) + '0' ;
-            length--;
-            break;
-        case 22:
-            UCA0TXBUF = ((combination % 1000)/100) + '0' ;
-            length--;
-            break;
-        case 21:
-            UCA0TXBUF = ((combination % 100)/10) + '0' ;
-            length--;
-            break;
-        case 20:
-            UCA0TXBUF = (combination % 10) + '0' ;
-            length--;
-            break;
-        case 19:
-            UCA0TXBUF = '\n';
-            length--;
-            break;
-        case 18:
-            UCA0TXBUF = 78; // 'N'
-            length--;
-            break;
-        case 17:
-            UCA0TXBUF = 101; // 'e'
-            length--;
-            break;
-        case 16:
-            UCA0TXBUF = 119; // 'w'
-            length--;
-            break;
-        case 15:
-            UCA0TXBUF = 32; // ' '
-            length--;
-            break;
-        case 14:
-            UCA0TXBUF = 103; // 'g'
-            length--;
-            break;
-        case 13:
-            UCA0TXBUF = 97; // 'a'
-            length--;
-            break;
-        case 12:
-            UCA0TXBUF = 109; // 'm'
-            length--;
-            break;
-        case 11:
-            UCA0TXBUF = 101; // 'e'
-            length--;
-            break;
-        case 10:
-            UCA0TXBUF = 32; // ' '
-            length--;
-            break;
-        case 9:
-            UCA0TXBUF = 91; // '['
-            length--;
-            break;
-        case 8:
-            UCA0TXBUF = 110; // 'n'
-            length--;
-            break;
-        case 7:
-            UCA0TXBUF = 93; // ']'
-            length--;
-            break;
-        case 6:
-            UCA0TXBUF = 43; // '+'
-            length--;
-            break;
-        case 5:
-            UCA0TXBUF = 91; // '['
-            length--;
-            break;
-        case 4:
-            UCA0TXBUF = 83; // 'S'
-            length--;
-            break;
-        case 3:
-            UCA0TXBUF = 51; // '3'
-            length--;
-            break;
-        case 2:
-            UCA0TXBUF = 93; // ']'
-            length--;
-            break;
-        case 1:
-            UCA0TXBUF = '\n';
-            length--;
-            break;
-        default:
-            break;
+    if(result == RESULT_WIN){
+        memcpy(position, final_win_message, MESSAGE_LENGTH(final_win_message));
+        position += MESSAGE_LENGTH(final_win_message);
+    }else{
+        memcpy(position, final_loss_message, MESSAGE_LENGTH(final_loss_message));
+        position += MESSAGE_LENGTH(final_loss_message);
+    }
+
+    memcpy(position, final_combination_message, MESSAGE_LENGTH(final_combination_message));
+    combination_digits_write(&position[FINAL_COMBINATION_SLOT], combination);
+    position += MESSAGE_LENGTH(final_combination_message);
+
+    memcpy(position, new_game_message, MESSAGE_LENGTH(new_game_message));
+    position += MESSAGE_LENGTH(new_game_message);
+
+    return uart_tx_write(message, position - message);
+}
+/**
+ * @brief Funkcija combination_digits_write
+ *
+ * - opis:
+ *      Funkcija upisuje COMBINATION_LENGTH simbola kombinacije kao ASCII cifre pocevsi od date pozicije.
+ *
+ * - argumenti:
+ *      - destination - pokazivac na prvu cifru
+ *      - combination - upakovana kombinacija
+ *
+ * - povratna vrednost:
+ *      nema
+ *
+ */
+void combination_digits_write(char *destination, combination_t combination){
+#if COMBINATION_LENGTH == 4
+    destination[0] = COMBINATION_SYMBOL(combination, 3) + '0';
+    destination[1] = COMBINATION_SYMBOL(combination, 2) + '0';
+    destination[2] = COMBINATION_SYMBOL(combination, 1) + '0';
+    destination[3] = COMBINATION_SYMBOL(combination, 0) + '0';
+#else
+    unsigned int i;
+
+    // cifre se upisuju s desna na levo, pa je potrebno samo pomeranje za 4 mesta
+    for(i = COMBINATION_LENGTH; i > 0; i--){
+        destination[i - 1] = (char)(combination & COMBINATION_SYMBOL_MASK) + '0';
+        combination >>= COMBINATION_SYMBOL_BITS;
     }
-    return length;
+#endif
+}
+/**
+ * @brief Funkcija combination_digits_read
+ *
+ * - opis:
+ *      Funkcija pakuje COMBINATION_LENGTH ASCII cifara u kombinaciju. Svaka cifra mora biti
+ *      iz skupa {1,...,COMBINATION_SYMBOLS}.
+ *
+ * - argumenti:
+ *      - source - pokazivac na prvu cifru
+ *
+ * - povratna vrednost:
+ *      Upakovana kombinacija ili COMBINATION_INVALID ako neka cifra nije ispravan simbol.
+ *
+ */
+combination_t combination_digits_read(const char *source){
+    unsigned int i;
+    unsigned int symbol;
+    combination_t combination = 0;
+
+    for(i=0; i<COMBINATION_LENGTH; i++){
+        symbol = (unsigned int)(source[i] - '0');
+        if(symbol < 1 || symbol > COMBINATION_SYMBOLS){
+            return COMBINATION_INVALID;
+        }
+        combination = (combination << COMBINATION_SYMBOL_BITS) | symbol;
+    }
+    return combination;
+}
+/**
+ * @brief Funkcija combination_next
+ *
+ * - opis:
+ *      Funkcija vraca sledecu kombinaciju u leksikografskom redosledu (1111, 1112, ..., 6666),
+ *      sa prenosom po 4-bitnim poljima umesto deljenja. Prva kombinacija je COMBINATION_LSB_MASK.
+ *
+ * - argumenti:
+ *      - combination - upakovana kombinacija
+ *
+ * - povratna vrednost:
+ *      Sledeca kombinacija; posle poslednje (66..6) vraca se prva (11..1).
+ *
+ */
+combination_t combination_next(combination_t combination){
+    unsigned int position;
+
+    for(position = 0; position < COMBINATION_LENGTH; position++){
+        unsigned int shift = position * COMBINATION_SYMBOL_BITS;
+
+        if(COMBINATION_SYMBOL(combination, position) < COMBINATION_SYMBOLS){
+            return combination + ((combination_t)1 << shift);
+        }
+        // poslednji simbol se vraca na 1 i prenosi se na sledecu poziciju
+        combination -= (combination_t)(COMBINATION_SYMBOLS - 1) << shift;
+    }
+    return combination;
+}
+/**
+ * @brief Funkcija decimal_write
+ *
+ * - opis:
+ *      Funkcija upisuje broj kao decimalne cifre (sa vodecim nulama). Cifre se dobijaju
+ *      uzastopnim oduzimanjem stepena broja 10, bez softverskog deljenja.
+ *      Vrednosti koje ne staju u zadati broj cifara se ispisuju kao 99..9.
+ *
+ * - argumenti:
+ *      - destination - pokazivac na prvu cifru
+ *      - value - broj koji treba upisati
+ *      - digits - broj cifara, najvise 8
+ *
+ * - povratna vrednost:
+ *      nema
+ *
+ */
+void decimal_write(char *destination, unsigned long value, unsigned int digits){
+    static const unsigned long powers_of_ten[8] = {10000000, 1000000, 100000, 10000, 1000, 100, 10, 1};
+    const unsigned long *power = &powers_of_ten[8 - digits];
+    unsigned int i;
+    char digit;
+
+    if(value >= power[0] * 10){
+        value = power[0] * 10 - 1;
+    }
+
+    for(i = 0; i < digits; i++){
+        digit = '0';
+        while(value >= power[i]){
+            value -= power[i];
+            digit++;
+        }
+        destination[i] = digit;
+    }
+}
+/**
+ * @brief Funkcija hint_print
+ *
+ * - opis:
+ *      Funkcija salje preko serijske veze predlog sledeceg pokusaja.
+ *      Format poruke: "Hint: xxxx C:cccc T:ttttms",
+ *      gde je: xxxx - predlozena kombinacija
+ *              cccc - broj kombinacija koje su jos moguce (COUNT_DIGITS cifara)
+ *              tttt - trajanje racunanja predloga u milisekundama
+ *
+ * - argumenti:
+ *      - combination - predlozena kombinacija
+ *      - remaining - broj mogucih kombinacija
+ *      - time_ms - trajanje racunanja u milisekundama
+ *
+ * - povratna vrednost:
+ *      1 ako je poruka upisana u bafer za slanje, 0 ako nema mesta.
+ */
+unsigned int hint_print(combination_t combination, unsigned long remaining, unsigned long time_ms){
+    char message[MESSAGE_LENGTH(hint_message)];
+
+    memcpy(message, hint_message, sizeof(message));
+
+    combination_digits_write(&message[HINT_COMBINATION_SLOT], combination);
+    decimal_write(&message[HINT_REMAINING_SLOT], remaining, COUNT_DIGITS);
+    decimal_write(&message[HINT_TIME_SLOT], time_ms, 4);
+
+    return uart_tx_write(message, sizeof(message));
+}
+/**
+ * @brief Funkcija power_stats_print
+ *
+ * - opis:
+ *      Funkcija salje preko serijske veze vreme koje je procesor u toku jedne igre
+ *      proveo aktivan i vreme koje je proveo u rezimu niske potrosnje (LPM0/LPM3).
+ *      Format poruke: "Active:aaaaaams Sleep:ssssssms".
+ *
+ * - argumenti:
+ *      - active_ms - vreme aktivnog rada u milisekundama
+ *      - sleep_ms - vreme u rezimu niske potrosnje u milisekundama
+ *
+ * - povratna vrednost:
+ *      1 ako je poruka upisana u bafer za slanje, 0 ako nema mesta.
+ */
+unsigned int power_stats_print(unsigned long active_ms, unsigned long sleep_ms){
+    char message[MESSAGE_LENGTH(power_message)];
+
+    memcpy(message, power_message, sizeof(message));
+
+    decimal_write(&message[POWER_ACTIVE_SLOT], active_ms, 6);
+    decimal_write(&message[POWER_SLEEP_SLOT], sleep_ms, 6);
+
+    return uart_tx_write(message, sizeof(message));
+}
+/**
+ * @brief Funkcija stats_print
+ *
+ * - opis:
+ *      Funkcija salje preko serijske veze statistiku od pokretanja aplikacije (komanda 's').
+ *      Format poruke: "Games:ggggg Won:wwwww #a C:cccc L:llllms D:ddd", gde je a broj pokusaja
+ *      u trenutnoj igri, c broj kombinacija koje su jos moguce (COUNT_DIGITS cifara), l najvece
+ *      kasnjenje od prekidne rutine do obrade dogadjaja, a d broj odbacenih dogadjaja i
+ *      primljenih bajtova.
+ *
+ * - argumenti:
+ *      - games - broj zapocetih igara
+ *      - won - broj dobijenih igara
+ *      - attempt - broj pokusaja u trenutnoj (ili poslednjoj) igri
+ *      - remaining - broj mogucih kombinacija
+ *      - latency_ms - najvece kasnjenje obrade dogadjaja u milisekundama
+ *      - dropped - broj odbacenih dogadjaja (pun red)
+ *
+ * - povratna vrednost:
+ *      1 ako je poruka upisana u bafer za slanje, 0 ako nema mesta.
+ */
+unsigned int stats_print(unsigned int games, unsigned int won, unsigned int attempt, unsigned long remaining,
+                         unsigned long latency_ms, unsigned int dropped){
+    char message[MESSAGE_LENGTH(stats_message)];
+
+    memcpy(message, stats_message, sizeof(message));
+
+    decimal_write(&message[STATS_GAMES_SLOT], games, 5);
+    decimal_write(&message[STATS_WON_SLOT], won, 5);
+    decimal_write(&message[STATS_ATTEMPT_SLOT], attempt, 1);
+    decimal_write(&message[STATS_REMAINING_SLOT], remaining, COUNT_DIGITS);
+    decimal_write(&message[STATS_LATENCY_SLOT], latency_ms, 4);
+    decimal_write(&message[STATS_DROPPED_SLOT], dropped, 3);
+
+    return uart_tx_write(message, sizeof(message));
+}
+/**
+ * @brief Funkcija command_error_print
+ *
+ * - opis:
+ *      Funkcija salje poruku 'Bad command\n' kada primljena linija nije ispravna komanda
+ *      ili komanda nije dozvoljena u trenutnom stanju.
+ *
+ * - argumenti:
+ *      nema
+ *
+ * - povratna vrednost:
+ *      1 ako je poruka upisana u bafer za slanje, 0 ako nema mesta.
+ */
+unsigned int command_error_print(void){
+    return uart_tx_write(command_error_message, MESSAGE_LENGTH(command_error_message));
 }
@@ -1,51 +1,181 @@
 #ifndef COMBINATION_H_
 #define COMBINATION_H_
+/**
+ * @brief Parametri igre
+ *
+ * Broj pozicija u kombinaciji (COMBINATION_LENGTH) i broj razlicitih simbola
+ * (COMBINATION_SYMBOLS) zadaju se pri prevodjenju, npr. --define=COMBINATION_LENGTH=5
+ * --define=COMBINATION_SYMBOLS=8. Podrazumevana igra je 4 x 6. Sve funkcije se
+ * specijalizuju za zadatu konfiguraciju u toku prevodjenja, pa podrazumevana verzija
+ * ima isti kod kao pre uvodjenja parametara.
+ *
+ * Ogranicenja: najvise 7 pozicija (broj pojavljivanja simbola mora biti manji od 8
+ * zbog zastitnog bita u combination_check) i najvise 8 simbola (histogram u dve reci
+ * i 3 bita pseudoslucajnog broja po simbolu).
+ *
+ */
+#ifndef COMBINATION_LENGTH
+#define COMBINATION_LENGTH              (4)
+#endif
+#ifndef COMBINATION_SYMBOLS
+#define COMBINATION_SYMBOLS             (6)
+#endif
+
+#if COMBINATION_LENGTH < 2 || COMBINATION_LENGTH > 7
+#error "COMBINATION_LENGTH mora biti iz opsega [2;7]"
+#endif
+#if COMBINATION_SYMBOLS < 2 || COMBINATION_SYMBOLS > 8
+#error "COMBINATION_SYMBOLS mora biti iz opsega [2;8]"
+#endif
+/**
+ * @brief Upakovana kombinacija
+ *
+ * Kombinacija se cuva u jednoj promenljivoj tipa combination_t, 4 bita po simbolu.
+ * Simbol na poziciji COMBINATION_LENGTH - 1 (prvi sleva, najtezi) je u najvisim bitima,
+ * a simbol na poziciji 0 (poslednji) u bitima 3..0. Tako se kombinacija 1165 cuva kao 0x1165,
+ * pa se u debageru cita isto kao ranije, a pakovanje i raspakivanje su samo pomeranja i maske,
+ * bez softverskog deljenja. Do 4 pozicije kombinacija staje u unsigned int (16 bita na
+ * MSP430), a za duze kombinacije se koristi unsigned long.
+ *
+ * Konverzija u ASCII cifre i nazad postoji samo na ivicama prema korisniku
+ * (combination_digits_write, combination_digits_read).
+ *
+ * - COMBINATION_LSB_MASK   -> najnizi bit svakog polja (0x1111), ujedno kombinacija 11..1
+ * - COMBINATION_CODE_COUNT -> broj svih kombinacija, COMBINATION_SYMBOLS ^ COMBINATION_LENGTH
+ *
+ */
+#if COMBINATION_LENGTH <= 4
+typedef unsigned int combination_t;
+#define COMBINATION_LSB_MASK            (0x1111u >> (4 * (4 - COMBINATION_LENGTH)))
+#else
+typedef unsigned long combination_t;
+#define COMBINATION_LSB_MASK            (0x1111111UL >> (4 * (7 - COMBINATION_LENGTH)))
+#endif
+
+#define COMBINATION_SYMBOL_BITS         (4)
+#define COMBINATION_SYMBOL_MASK         (0xF)
+#define COMBINATION_SYMBOL(combination, position) \
+        (((combination) >> ((position) * COMBINATION_SYMBOL_BITS)) & COMBINATION_SYMBOL_MASK)
+#define COMBINATION_INVALID             ((combination_t)~(combination_t)0)
+
+#define COMBINATION_SYMBOLS_2           (COMBINATION_SYMBOLS * COMBINATION_SYMBOLS)
+#define COMBINATION_SYMBOLS_4           (COMBINATION_SYMBOLS_2 * COMBINATION_SYMBOLS_2)
+#if COMBINATION_LENGTH == 2
+#define COMBINATION_CODE_COUNT          (COMBINATION_SYMBOLS_2)
+#elif COMBINATION_LENGTH == 3
+#define COMBINATION_CODE_COUNT          (COMBINATION_SYMBOLS_2 * COMBINATION_SYMBOLS)
+#elif COMBINATION_LENGTH == 4
+#define COMBINATION_CODE_COUNT          (COMBINATION_SYMBOLS_4)
+#elif COMBINATION_LENGTH == 5
+#define COMBINATION_CODE_COUNT          (1UL * COMBINATION_SYMBOLS_4 * COMBINATION_SYMBOLS)
+#elif COMBINATION_LENGTH == 6
+#define COMBINATION_CODE_COUNT          (1UL * COMBINATION_SYMBOLS_4 * COMBINATION_SYMBOLS_2)
+#else
+#define COMBINATION_CODE_COUNT          (1UL * COMBINATION_SYMBOLS_4 * COMBINATION_SYMBOLS_2 * COMBINATION_SYMBOLS)
+#endif
+/**
+ * @brief Upakovan rezultat
+ *
+ * Rezultat poredjenja kombinacija je takodje upakovan po 4 bita:
+ * 0xSWN - S skroz tacnih simbola, W simbola na pogresnom mestu, N netacnih.
+ * Npr. 0x301 su 3 tacna i 1 netacan simbol, a RESULT_WIN (0x400 u igri 4 x 6) je pogodjena kombinacija.
+ *
+ */
+#define RESULT_PACK(scored, wrong_place, wrong) \
+        (((scored) << 8) | ((wrong_place) << 4) | (wrong))
+#define RESULT_SCORED(result)           (((result) >> 8) & 0xF)
+#define RESULT_WRONG_PLACE(result)      (((result) >> 4) & 0xF)
+#define RESULT_WRONG(result)            ((result) & 0xF)
+#define RESULT_WIN                      RESULT_PACK(COMBINATION_LENGTH, 0, 0)
 /**
  * @brief Funkcija new_game_print
  *
  * - opis:
- *      Funkcija ispisuje poruku nakon aplikacije.
+ *      Funkcija salje poruku nakon pokretanja aplikacije.
  *      Poruka je sledeca 'New game [n]+[S3]'.
  *      Poruka oznacava da treba pritisnuti slovo 'n' i kliknuti taster S3.
  *
  * - argumenti:
- *      - string_length - duzina poruke koja se ispisuje na pocetku igre
+ *      nema
  *
  * - povratna vrednost:
- *      Dekrementirana duzina poruke.
+ *      1 ako je poruka upisana u bafer za slanje, 0 ako nema mesta.
  *
  */
-extern unsigned int new_game_print(unsigned int string_length);
+extern unsigned int new_game_print(void);
 /**
  * @brief Funkcija combination_generate
  *
  * - opis:
  *      Funkcija nasumicno generise kombinaciju koju treba pogoditi
- *      u toku jedne igre. Kombinacija je cetvorocifreni broj kod kojeg
- *      svaka cifra pripada skupu {1,2,3,4,5,6}.
+ *      u toku jedne igre. Kombinacija se sastoji od COMBINATION_LENGTH simbola iz skupa
+ *      {1,...,COMBINATION_SYMBOLS} (podrazumevano 4 simbola iz {1,2,3,4,5,6}),
+ *      upakovanih po 4 bita (vidi COMBINATION_SYMBOL). Koristi se celobrojni
+ *      xorshift generator, bez rand(), time() i pow().
  *
  * - argumenti:
  *      nema
  *
  * - povratna vrednost:
- *      Nasumicno generisana kombinacija, npr: 1165.
+ *      Nasumicno generisana kombinacija, npr: 0x1165.
+ *
+ */
+extern combination_t combination_generate(void);
+/**
+ * @brief Funkcija combination_seed
+ *
+ * - opis:
+ *      Funkcija mesa novu vrednost u stanje generatora pseudoslucajnih brojeva
+ *      koji koristi combination_generate.
+ *
+ * - argumenti:
+ *      - seed - vrednost koja se umesava u stanje (npr. vremenska oznaka klika na taster)
+ *
+ * - povratna vrednost:
+ *      nema
  *
  */
-extern unsigned int combination_generate(void);
+extern void combination_seed(unsigned int seed);
+/**
+ * @brief Funkcija combination_seed_set
+ *
+ * - opis:
+ *      Funkcija postavlja stanje generatora na zadatu vrednost i iskljucuje umesavanje
+ *      entropije, pa su sledece igre ponovljive (komanda "s <broj>").
+ *
+ * - argumenti:
+ *      - seed - novo stanje generatora; 0 ponovo ukljucuje umesavanje entropije
+ *
+ * - povratna vrednost:
+ *      nema
+ *
+ */
+extern void combination_seed_set(unsigned int seed);
+/**
+ * @brief Histerezis pri izboru simbola potenciometrom
+ *
+ * Sirina pojasa (u jedinicama 12-bitnog AD rezultata) za koju usrednjen rezultat
+ * mora da predje granicu simbola da bi se izabrani simbol promenio. 64 jedinice
+ * su cetvrtina koraka ranijeg 4-bitnog rezultata (oko 50mV pri AVCC = 3.3V).
+ *
+ */
+#define ADC_HYSTERESIS                  (64)
 /**
  * @brief Funkcija ADC_symbol_map
  *
  * - opis:
- *      Funkcija mapira vrednosti iz opsega [0;15] na opseg [1;6].
+ *      Funkcija mapira usrednjen rezultat AD konverzije na opseg [1;COMBINATION_SYMBOLS], uz histerezis
+ *      oko granica simbola (ADC_HYSTERESIS).
  *
  * - argumenti:
- *      - ad_result - vrednost dobijena AD konverzijom iz opsega [0;15]
+ *      - ad_average - usrednjen rezultat AD konverzije iz opsega [0;4095]
+ *      - symbol - prethodno izabran simbol (vrednost van [1;COMBINATION_SYMBOLS] iskljucuje histerezis)
  *
  * - povratna vrednost:
- *      Premapiran simbol na opseg [1;6].
+ *      Premapiran simbol na opseg [1;COMBINATION_SYMBOLS].
  *
  */
-extern unsigned int ADC_symbol_map(unsigned int ad_result);
+extern unsigned int ADC_symbol_map(unsigned int ad_average, unsigned int symbol);
 /**
  * @brief Funkcija symbol_push
  *
@@ -57,15 +187,27 @@ extern unsigned int ADC_symbol_map(unsigned int ad_result);
  *      - symbol - izabran simbol
  *
  * - povratna vrednost:
- *      Vrednost koju treba dodati na trenutnu kombinaciju.
+ *      Vrednost koju treba dodati (ili OR-ovati) na trenutnu upakovanu kombinaciju.
+ *
+ */
+extern combination_t symbol_push(unsigned int index, unsigned int symbol);
+/**
+ * @brief Bafer LED displeja
+ *
+ * Kodovani izlazi za 4 sedmosegmentna displeja (pozicija 0 je prvi sleva). Bafer cita
+ * prekidna rutina tajmera CCR0ISR i multipleksira displeje; igra samo upisuje simbole.
  *
  */
-extern unsigned int symbol_push(unsigned int index, unsigned int symbol);
+#define DISPLAY_DIGITS                  (4)
+
+extern volatile unsigned char display_framebuffer[DISPLAY_DIGITS];
 /**
  * @brief Funkcija LED_display_print
  *
  * - opis:
- *      Funkcija ispisuje na LED displej izabran simbol.
+ *      Funkcija upisuje izabran simbol u bafer LED displeja; displej osvezava prekidna
+ *      rutina tajmera. Ako je kombinacija duza od DISPLAY_DIGITS, sadrzaj displeja se
+ *      pomera ulevo, pa su uvek vidljivi poslednji izabrani simboli.
  *
  * - argumenti:
  *      - LED_display_index - redni broj sedmosegmentnog displeja na koji treba da se ispise broj
@@ -76,54 +218,211 @@ extern unsigned int symbol_push(unsigned int index, unsigned int symbol);
  *
  */
 extern unsigned int LED_display_print(unsigned int LED_display_index, unsigned int digit);
+/**
+ * @brief Funkcija display_clear
+ *
+ * - opis:
+ *      Funkcija upisuje nulu (prazno mesto) na sva 4 LED displeja.
+ *
+ * - argumenti:
+ *      nema
+ *
+ * - povratna vrednost:
+ *      nema
+ *
+ */
+extern void display_clear(void);
 /**
  * @brief Funkcija combination_check
  *
  * - opis:
- *      Funkcija proverava trenutnu i pravu kombinaciju.
+ *      Funkcija proverava trenutnu i pravu kombinaciju. Radi direktno nad upakovanim
+ *      kombinacijama (SWAR), bez deljenja i grananja, pa je broj ciklusa uvek isti.
  *
  * - argumenti:
  *      - combination - korisnikova izabrana kombinacija
  *      - true_combination - prava kombinacija, sa njom se vrsi poredjenje
  *
  * - povratna vrednost:
- *      Rezultat, trocifren broj, kod kojeg prva cifra sleva govori koliko skroz tacnih simbola
- *      ima, druga koliko ih ima na pogresnom mestu, a treca koliko netacnih.
+ *      Rezultat upakovan po 4 bita (RESULT_PACK), kod kojeg najvisa grupa govori koliko skroz
+ *      tacnih simbola ima, srednja koliko ih ima na pogresnom mestu, a najniza koliko netacnih.
  *
  */
-extern unsigned int combination_check(unsigned int combination, unsigned int true_combination);
+extern unsigned int combination_check(combination_t combination, combination_t true_combination);
+/**
+ * @brief Funkcija combination_check_reference
+ *
+ * - opis:
+ *      Referentna (originalna) implementacija provere kombinacija preko nizova i histograma.
+ *      Daje isti rezultat kao combination_check i koristi se za poredjenje i merenje.
+ *
+ * - argumenti:
+ *      - combination - korisnikova izabrana kombinacija
+ *      - true_combination - prava kombinacija, sa njom se vrsi poredjenje
+ *
+ * - povratna vrednost:
+ *      Rezultat upakovan po 4 bita (RESULT_PACK).
+ *
+ */
+extern unsigned int combination_check_reference(combination_t combination, combination_t true_combination);
 /**
  * @brief Funkcija step_results_print
  *
  * - opis:
- *      Funkcija salje preko TX bafera i serijske veze poruku o trenutno izabranoj
+ *      Funkcija salje preko serijske veze poruku o trenutno izabranoj
  *      kombinaciji i broju pogodjenjih, broju promasenih simbola i rednom broju pokusaja.
+ *      Poruka se cela upisuje u bafer za slanje, a salje je UART prekidna rutina.
  *
  * - argumenti:
  *      - combination - korisnikova izabrana kombinacija
  *      - result - rezultat dobijen nakon poredjenja kombinacija
  *      - attempt_ordinal_number - redni broj pokusaja u okviru jedne igre
- *      - string_length - duzina poruke koju treba poslati
  *
  * - povratna vrednost:
- *      Dekrementira duzina poruke.
+ *      1 ako je poruka upisana u bafer za slanje, 0 ako nema mesta.
  */
-extern unsigned int step_results_print(unsigned int combination, unsigned int result, unsigned int attempt_ordinal_number, unsigned int string_length);
+extern unsigned int step_results_print(combination_t combination, unsigned int result, unsigned int attempt_ordinal_number);
 /**
  * @brief Funkcija final_results_print
  *
  * - opis:
- *      Funkcija salje preko TX bafera i serijske veze poruku o pravoj kombinaciji
- *      koju je trebalo pogoditi.
+ *      Funkcija salje preko serijske veze poruku o pravoj kombinaciji
+ *      koju je trebalo pogoditi, krajnjem rezultatu igre i poruku za novu igru.
  *
  * - argumenti:
  *      - combination - prava kombinacija koju je trebalo pogoditi
  *      - result - rezultat dobijen nakon poredjenja kombinacija
- *      - string_length - duzina poruke koju treba poslati
  *
  * - povratna vrednost:
- *      Dekrementira duzina poruke.
+ *      1 ako je poruka upisana u bafer za slanje, 0 ako nema mesta.
+ */
+extern unsigned int final_results_print(combination_t combination, unsigned int result);
+/**
+ * @brief Funkcija combination_digits_write
+ *
+ * - opis:
+ *      Funkcija upisuje COMBINATION_LENGTH simbola kombinacije kao ASCII cifre pocevsi od date pozicije.
+ *
+ * - argumenti:
+ *      - destination - pokazivac na prvu cifru
+ *      - combination - upakovana kombinacija
+ *
+ * - povratna vrednost:
+ *      nema
+ *
+ */
+extern void combination_digits_write(char *destination, combination_t combination);
+/**
+ * @brief Funkcija combination_digits_read
+ *
+ * - opis:
+ *      Funkcija pakuje COMBINATION_LENGTH ASCII cifara u kombinaciju. Svaka cifra mora biti
+ *      iz skupa {1,...,COMBINATION_SYMBOLS}.
+ *
+ * - argumenti:
+ *      - source - pokazivac na prvu cifru
+ *
+ * - povratna vrednost:
+ *      Upakovana kombinacija ili COMBINATION_INVALID ako neka cifra nije ispravan simbol.
+ *
+ */
+extern combination_t combination_digits_read(const char *source);
+/**
+ * @brief Funkcija combination_next
+ *
+ * - opis:
+ *      Funkcija vraca sledecu kombinaciju u leksikografskom redosledu (1111, 1112, ..., 6666),
+ *      sa prenosom po 4-bitnim poljima umesto deljenja. Prva kombinacija je COMBINATION_LSB_MASK.
+ *
+ * - argumenti:
+ *      - combination - upakovana kombinacija
+ *
+ * - povratna vrednost:
+ *      Sledeca kombinacija; posle poslednje (66..6) vraca se prva (11..1).
+ *
+ */
+extern combination_t combination_next(combination_t combination);
+/**
+ * @brief Funkcija decimal_write
+ *
+ * - opis:
+ *      Funkcija upisuje broj kao decimalne cifre (sa vodecim nulama), bez softverskog
+ *      deljenja. Vrednosti koje ne staju u zadati broj cifara se ispisuju kao 99..9.
+ *
+ * - argumenti:
+ *      - destination - pokazivac na prvu cifru
+ *      - value - broj koji treba upisati
+ *      - digits - broj cifara, najvise 8
+ *
+ * - povratna vrednost:
+ *      nema
+ *
+ */
+extern void decimal_write(char *destination, unsigned long value, unsigned int digits);
+/**
+ * @brief Funkcija hint_print
+ *
+ * - opis:
+ *      Funkcija salje preko serijske veze predlog sledeceg pokusaja, broj kombinacija
+ *      koje su jos moguce i trajanje racunanja predloga.
+ *
+ * - argumenti:
+ *      - combination - predlozena kombinacija
+ *      - remaining - broj mogucih kombinacija
+ *      - time_ms - trajanje racunanja u milisekundama
+ *
+ * - povratna vrednost:
+ *      1 ako je poruka upisana u bafer za slanje, 0 ako nema mesta.
+ */
+extern unsigned int hint_print(combination_t combination, unsigned long remaining, unsigned long time_ms);
+/**
+ * @brief Funkcija power_stats_print
+ *
+ * - opis:
+ *      Funkcija salje preko serijske veze vreme koje je procesor u toku jedne igre
+ *      proveo aktivan i vreme koje je proveo u rezimu niske potrosnje.
+ *
+ * - argumenti:
+ *      - active_ms - vreme aktivnog rada u milisekundama
+ *      - sleep_ms - vreme u rezimu niske potrosnje u milisekundama
+ *
+ * - povratna vrednost:
+ *      1 ako je poruka upisana u bafer za slanje, 0 ako nema mesta.
+ */
+extern unsigned int power_stats_print(unsigned long active_ms, unsigned long sleep_ms);
+/**
+ * @brief Funkcija stats_print
+ *
+ * - opis:
+ *      Funkcija salje preko serijske veze broj zapocetih i dobijenih igara, broj pokusaja
+ *      u trenutnoj igri, broj kombinacija koje su jos moguce, najvece kasnjenje obrade
+ *      dogadjaja i broj odbacenih dogadjaja.
+ *
+ * - argumenti:
+ *      - games - broj zapocetih igara
+ *      - won - broj dobijenih igara
+ *      - attempt - broj pokusaja u trenutnoj igri
+ *      - remaining - broj mogucih kombinacija
+ *      - latency_ms - najvece kasnjenje obrade dogadjaja u milisekundama
+ *      - dropped - broj odbacenih dogadjaja
+ *
+ * - povratna vrednost:
+ *      1 ako je poruka upisana u bafer za slanje, 0 ako nema mesta.
+ */
+extern unsigned int stats_print(unsigned int games, unsigned int won, unsigned int attempt, unsigned long remaining,
+                                unsigned long latency_ms, unsigned int dropped);
+/**
+ * @brief Funkcija command_error_print
+ *
+ * - opis:
+ *      Funkcija salje poruku o neispravnoj komandi preko serijske veze.
+ *
+ * - argumenti:
+ *      nema
+ *
+ * - povratna vrednost:
+ *      1 ako je poruka upisana u bafer za slanje, 0 ako nema mesta.
  */
-extern unsigned int final_results_print(unsigned int combination, unsigned int result, unsigned int string_length);
+extern unsigned int command_error_print(void);
 
-#endif /* COMBINATION_H_ */
+#endif /* COMBINATION_H_ */
\ No newline at end of file
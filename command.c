@@ -0,0 +1,97 @@
+#include "combination.h"
+#include "command.h"
+
+/**
+ * @brief Linija koja se sastavlja
+ *
+ * - command_line        - primljeni bajtovi od pocetka linije
+ * - command_length      - broj bajtova u liniji
+ * - command_overflow    - linija je duza od bafera; odbacuje se do kraja linije
+ *
+ */
+static char command_line[COMMAND_LINE_SIZE];
+static unsigned int command_length = 0;
+static unsigned int command_overflow = 0;
+
+/**
+ * @brief Funkcija decimal_read
+ *
+ * - opis:
+ *      Cita decimalan broj (najvise 5 cifara, do 65535) iz dela linije.
+ *
+ * - povratna vrednost:
+ *      1 ako je broj ispravan, inace 0.
+ *
+ */
+static unsigned int decimal_read(const char *source, unsigned int length, unsigned long *value){
+    unsigned int i;
+
+    if(length == 0 || length > 5){
+        return 0;
+    }
+    *value = 0;
+    for(i = 0; i < length; i++){
+        if(source[i] < '0' || source[i] > '9'){
+            return 0;
+        }
+        *value = *value * 10 + (source[i] - '0');
+    }
+    return *value <= 0xFFFF;
+}
+
+// tumacenje zavrsene linije
+static unsigned int command_parse(unsigned long *argument){
+    if(command_overflow){
+        return COMMAND_INVALID;
+    }
+    if(command_length == COMBINATION_LENGTH && command_line[0] >= '0' && command_line[0] <= '9'){
+        combination_t guess = combination_digits_read(command_line);
+
+        if(guess == COMBINATION_INVALID){
+            return COMMAND_INVALID;
+        }
+        *argument = guess;
+        return COMMAND_GUESS;
+    }
+    if(command_line[0] == 's'){
+        if(command_length == 1){
+            return COMMAND_STATS;
+        }
+        if(command_line[1] == ' ' && decimal_read(&command_line[2], command_length - 2, argument)){
+            return COMMAND_SEED;
+        }
+    }
+    return COMMAND_INVALID;
+}
+
+unsigned int command_feed(char character, unsigned long *argument){
+    unsigned int command;
+
+    if(character == '\r' || character == '\n'){
+        if(command_length == 0){
+            return COMMAND_NONE;
+        }
+        command = command_parse(argument);
+        command_length = 0;
+        command_overflow = 0;
+        return command;
+    }
+
+    if(command_length == 0){
+        switch(character){
+        case 'n':
+            return COMMAND_NEW_GAME;
+        case 'h':
+            return COMMAND_HINT;
+        case 'p':
+            return COMMAND_PROFILE;
+        }
+    }
+
+    if(command_length < COMMAND_LINE_SIZE){
+        command_line[command_length++] = character;
+    }else{
+        command_overflow = 1;
+    }
+    return COMMAND_NONE;
+}
@@ -0,0 +1,48 @@
+#ifndef COMMAND_H_
+#define COMMAND_H_
+/**
+ * @brief Komande preko serijske veze
+ *
+ * Glavni program prosledjuje svaki primljen bajt funkciji command_feed, koja sastavlja
+ * liniju i vraca prepoznatu komandu. Komande od jednog slova deluju odmah, bez Enter-a
+ * (kao i ranije, kada je prekidna rutina reagovala na pojedinacan bajt), ali samo na
+ * pocetku linije:
+ * - n              -> nova igra (u stanju IDLE/END prelazak na cekanje, zatim S3 ili ponovo n)
+ * - h              -> predlog sledeceg pokusaja
+ * - p              -> tabela profilisanja (samo uz PROFILE)
+ * Ostale komande se zavrsavaju sa '\r' ili '\n':
+ * - 1234           -> pokusaj otkucan ciframa (COMBINATION_LENGTH cifara), umesto potenciometra i S2
+ * - s              -> statistika (odigrane i dobijene igre, pokusaji, moguce kombinacije)
+ * - s <broj>       -> ponovljive igre: stanje generatora se postavlja na broj, a entropija
+ *                     se vise ne umesava (s 0 vraca slucajne igre)
+ * Prazne linije se ignorisu; neispravna ili preduga linija daje COMMAND_INVALID.
+ *
+ */
+#define COMMAND_NONE            (0)     // linija jos nije zavrsena
+#define COMMAND_NEW_GAME        (1)
+#define COMMAND_HINT            (2)
+#define COMMAND_PROFILE         (3)
+#define COMMAND_GUESS           (4)     // argument: upakovana kombinacija
+#define COMMAND_STATS           (5)
+#define COMMAND_SEED            (6)     // argument: nova vrednost stanja generatora
+#define COMMAND_INVALID         (7)
+
+#define COMMAND_LINE_SIZE       (16)
+/**
+ * @brief Funkcija command_feed
+ *
+ * - opis:
+ *      Funkcija dodaje primljen bajt u liniju koja se sastavlja i, kada je komanda
+ *      zavrsena, vraca njen kod. Poziva je samo glavni program.
+ *
+ * - argumenti:
+ *      - character - primljen bajt
+ *      - argument - izlaz, argument komande (za COMMAND_GUESS i COMMAND_SEED)
+ *
+ * - povratna vrednost:
+ *      Kod komande (COMMAND_*), ili COMMAND_NONE ako komanda jos nije zavrsena.
+ *
+ */
+extern unsigned int command_feed(char character, unsigned long *argument);
+
+#endif /* COMMAND_H_ */
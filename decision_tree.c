@@ -0,0 +1,1398 @@
+/*
+ * Automatski generisan fajl (host/tree_gen.c). Ne menjati rucno.
+ * 1378 cvorova, 8268 bajtova, najvise 5 pokusaja, prosecno 4.476 pokusaja.
+ */
+#include "decision_tree.h"
+
+#if DECISION_TREE_AVAILABLE
+
+const unsigned int decision_tree_node_count = 1378;
+
+// klasa rezultata za indeks 5 * tacni + na pogresnom mestu (0xFF - nemoguc rezultat ili pogodak)
+const unsigned char decision_tree_class[DECISION_TREE_RESULT_SLOTS] = {
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0xFF, 0x09, 0x0A, 0x0B, 0xFF, 0xFF, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+};
+
+// stablo odlucivanja: {pokusaj, indeks prvog deteta, maska klasa rezultata sa decom}
+const decision_tree_node decision_tree[] = {
+        {0x1122,    1, 0x1EFF},
+        {0x3345,   13, 0x1FFF},
+        {0x2344,  279, 0x1FEF},
+        {0x2344,  548, 0x16EF},
+        {0x1213,  646, 0x1FC0},
+        {0x2211,    0, 0x0000},
+        {0x1344,  666, 0x1FEF},
+        {0x1134,  936, 0x1FEF},
+        {0x1213, 1148, 0x1EDC},
+        {0x1234, 1189, 0x1FFE},
+        {0x1223, 1312, 0x1EDC},
+        {0x1213, 1350, 0x1488},
+        {0x1223, 1354, 0x1FC0},
+        {0x6666,    0, 0x0000},
+        {0x6646,   26, 0x1EE4},
+        {0x6634,   44, 0x1FEE},
+        {0x4653,   87, 0x1FD8},
+        {0x4533,  106, 0x0800},
+        {0x3656,  107, 0x16EF},
+        {0x3636,  125, 0x1EFF},
+        {0x3454,  171, 0x1FDC},
+        {0x3453,  211, 0x0910},
+        {0x3636,  214, 0x1EEF},
+        {0x3443,  244, 0x1EC4},
+        {0x3435,  263, 0x0910},
+        {0x3446,  267, 0x16E0},
+        {0x4464,    0, 0x0000},
+        {0x5556,    0, 0x0000},
+        {0x5566,    0, 0x0000},
+        {0x1416,   34, 0x0244},
+        {0x5656,   37, 0x0800},
+        {0x5666,   38, 0x0C00},
+        {0x1416,   40, 0x0244},
+        {0x6636,   43, 0x1000},
+        {0x4664,    0, 0x0000},
+        {0x6464,    0, 0x0000},
+        {0x4466,    0, 0x0000},
+        {0x6556,    0, 0x0000},
+        {0x6663,    0, 0x0000},
+        {0x6566,    0, 0x0000},
+        {0x6664,    0, 0x0000},
+        {0x4666,    0, 0x0000},
+        {0x6466,    0, 0x0000},
+        {0x6656,    0, 0x0000},
+        {0x5553,    0, 0x0000},
+        {0x4556,   55, 0x1880},
+        {0x4566,   58, 0x0A00},
+        {0x1444,   60, 0x0660},
+        {0x5653,   64, 0x09C4},
+        {0x4656,   69, 0x0A88},
+        {0x4663,   73, 0x0800},
+        {0x4654,   74, 0x1E00},
+        {0x5636,   78, 0x0D08},
+        {0x4636,   82, 0x0800},
+        {0x1413,   83, 0x0066},
+        {0x5563,    0, 0x0000},
+        {0x5456,    0, 0x0000},
+        {0x4456,    0, 0x0000},
+        {0x4463,    0, 0x0000},
+        {0x5466,    0, 0x0000},
+        {0x5554,    0, 0x0000},
+        {0x4554,    0, 0x0000},
+        {0x5454,    0, 0x0000},
+        {0x4454,    0, 0x0000},
+        {0x4564,    0, 0x0000},
+        {0x5464,    0, 0x0000},
+        {0x5564,    0, 0x0000},
+        {0x5536,    0, 0x0000},
+        {0x6553,    0, 0x0000},
+        {0x6563,    0, 0x0000},
+        {0x5663,    0, 0x0000},
+        {0x4436,    0, 0x0000},
+        {0x6456,    0, 0x0000},
+        {0x6463,    0, 0x0000},
+        {0x4434,    0, 0x0000},
+        {0x6554,    0, 0x0000},
+        {0x6454,    0, 0x0000},
+        {0x5654,    0, 0x0000},
+        {0x6564,    0, 0x0000},
+        {0x6653,    0, 0x0000},
+        {0x5664,    0, 0x0000},
+        {0x6536,    0, 0x0000},
+        {0x6436,    0, 0x0000},
+        {0x6654,    0, 0x0000},
+        {0x4634,    0, 0x0000},
+        {0x6633,    0, 0x0000},
+        {0x6434,    0, 0x0000},
+        {0x5434,   96, 0x1000},
+        {0x5436,   97, 0x0100},
+        {0x5533,    0, 0x0000},
+        {0x4534,   98, 0x0240},
+        {0x4536,  100, 0x0110},
+        {0x4433,    0, 0x0000},
+        {0x5453,  102, 0x0200},
+        {0x4563,  103, 0x0100},
+        {0x4453,  104, 0x1200},
+        {0x5534,    0, 0x0000},
+        {0x6534,    0, 0x0000},
+        {0x6433,    0, 0x0000},
+        {0x6533,    0, 0x0000},
+        {0x5463,    0, 0x0000},
+        {0x5634,    0, 0x0000},
+        {0x5633,    0, 0x0000},
+        {0x6453,    0, 0x0000},
+        {0x4633,    0, 0x0000},
+        {0x4553,    0, 0x0000},
+        {0x5433,    0, 0x0000},
+        {0x4444,    0, 0x0000},
+        {0x6444,    0, 0x0000},
+        {0x5565,    0, 0x0000},
+        {0x6565,    0, 0x0000},
+        {0x4446,  117, 0x0801},
+        {0x6446,  119, 0x0820},
+        {0x5665,  121, 0x1040},
+        {0x4646,  123, 0x1020},
+        {0x6655,    0, 0x0000},
+        {0x3666,    0, 0x0000},
+        {0x5555,    0, 0x0000},
+        {0x4644,    0, 0x0000},
+        {0x6555,    0, 0x0000},
+        {0x6644,    0, 0x0000},
+        {0x6366,    0, 0x0000},
+        {0x6665,    0, 0x0000},
+        {0x5655,    0, 0x0000},
+        {0x6646,    0, 0x0000},
+        {0x4544,  137, 0x1A84},
+        {0x4565,  142, 0x19A0},
+        {0x4364,  147, 0x0050},
+        {0x6364,    0, 0x0000},
+        {0x6363,    0, 0x0000},
+        {0x4546,  149, 0x19A0},
+        {0x1565,  154, 0x066A},
+        {0x4366,  160, 0x1450},
+        {0x3556,  164, 0x0050},
+        {0x3466,  166, 0x1808},
+        {0x3663,  169, 0x0010},
+        {0x3633,  170, 0x0200},
+        {0x5455,    0, 0x0000},
+        {0x4455,    0, 0x0000},
+        {0x4555,    0, 0x0000},
+        {0x5444,    0, 0x0000},
+        {0x5544,    0, 0x0000},
+        {0x4443,    0, 0x0000},
+        {0x6544,    0, 0x0000},
+        {0x6455,    0, 0x0000},
+        {0x5465,    0, 0x0000},
+        {0x4465,    0, 0x0000},
+        {0x6443,    0, 0x0000},
+        {0x6465,    0, 0x0000},
+        {0x5535,    0, 0x0000},
+        {0x4655,    0, 0x0000},
+        {0x5644,    0, 0x0000},
+        {0x5446,    0, 0x0000},
+        {0x5546,    0, 0x0000},
+        {0x4643,    0, 0x0000},
+        {0x5356,    0, 0x0000},
+        {0x3464,    0, 0x0000},
+        {0x6546,    0, 0x0000},
+        {0x4665,    0, 0x0000},
+        {0x6535,    0, 0x0000},
+        {0x6643,    0, 0x0000},
+        {0x6333,    0, 0x0000},
+        {0x6356,    0, 0x0000},
+        {0x5366,    0, 0x0000},
+        {0x5635,    0, 0x0000},
+        {0x5646,    0, 0x0000},
+        {0x6635,    0, 0x0000},
+        {0x3664,    0, 0x0000},
+        {0x3566,    0, 0x0000},
+        {0x6336,    0, 0x0000},
+        {0x3656,    0, 0x0000},
+        {0x1436,  181, 0x066C},
+        {0x4535,  187, 0x1188},
+        {0x4543,    0, 0x0000},
+        {0x3536,  191, 0x1898},
+        {0x4356,  196, 0x0318},
+        {0x4435,  200, 0x0100},
+        {0x3463,  201, 0x1F00},
+        {0x3564,  206, 0x0180},
+        {0x4354,    0, 0x0000},
+        {0x3456,  208, 0x0E00},
+        {0x5363,    0, 0x0000},
+        {0x4363,    0, 0x0000},
+        {0x5333,    0, 0x0000},
+        {0x4333,    0, 0x0000},
+        {0x5336,    0, 0x0000},
+        {0x4336,    0, 0x0000},
+        {0x5643,    0, 0x0000},
+        {0x6543,    0, 0x0000},
+        {0x5543,    0, 0x0000},
+        {0x4635,    0, 0x0000},
+        {0x5353,    0, 0x0000},
+        {0x6353,    0, 0x0000},
+        {0x6334,    0, 0x0000},
+        {0x3563,    0, 0x0000},
+        {0x3533,    0, 0x0000},
+        {0x5435,    0, 0x0000},
+        {0x6435,    0, 0x0000},
+        {0x5364,    0, 0x0000},
+        {0x4334,    0, 0x0000},
+        {0x5443,    0, 0x0000},
+        {0x3634,    0, 0x0000},
+        {0x3553,    0, 0x0000},
+        {0x3653,    0, 0x0000},
+        {0x3436,    0, 0x0000},
+        {0x3433,    0, 0x0000},
+        {0x5354,    0, 0x0000},
+        {0x6354,    0, 0x0000},
+        {0x3434,    0, 0x0000},
+        {0x3554,    0, 0x0000},
+        {0x3654,    0, 0x0000},
+        {0x5334,    0, 0x0000},
+        {0x3534,    0, 0x0000},
+        {0x4353,    0, 0x0000},
+        {0x1444,  225, 0x0660},
+        {0x6445,  229, 0x1060},
+        {0x5365,  232, 0x0840},
+        {0x6365,    0, 0x0000},
+        {0x4645,  234, 0x1060},
+        {0x3565,  237, 0x0044},
+        {0x3363,  239, 0x0040},
+        {0x3446,  240, 0x0860},
+        {0x3665,    0, 0x0000},
+        {0x3366,    0, 0x0000},
+        {0x3336,  243, 0x0200},
+        {0x5545,    0, 0x0000},
+        {0x4545,    0, 0x0000},
+        {0x5445,    0, 0x0000},
+        {0x4445,    0, 0x0000},
+        {0x5355,    0, 0x0000},
+        {0x4344,    0, 0x0000},
+        {0x6545,    0, 0x0000},
+        {0x6344,    0, 0x0000},
+        {0x6355,    0, 0x0000},
+        {0x3555,    0, 0x0000},
+        {0x3444,    0, 0x0000},
+        {0x5645,    0, 0x0000},
+        {0x4346,    0, 0x0000},
+        {0x6645,    0, 0x0000},
+        {0x6346,    0, 0x0000},
+        {0x3333,    0, 0x0000},
+        {0x3655,    0, 0x0000},
+        {0x3644,    0, 0x0000},
+        {0x3646,    0, 0x0000},
+        {0x4355,  251, 0x1600},
+        {0x3356,  254, 0x0580},
+        {0x3334,  257, 0x1200},
+        {0x3455,  259, 0x1280},
+        {0x3544,  262, 0x0040},
+        {0x4343,    0, 0x0000},
+        {0x3643,    0, 0x0000},
+        {0x6335,    0, 0x0000},
+        {0x5335,    0, 0x0000},
+        {0x4365,    0, 0x0000},
+        {0x3535,    0, 0x0000},
+        {0x3635,    0, 0x0000},
+        {0x5346,    0, 0x0000},
+        {0x5344,    0, 0x0000},
+        {0x3364,    0, 0x0000},
+        {0x3546,    0, 0x0000},
+        {0x3353,    0, 0x0000},
+        {0x3465,    0, 0x0000},
+        {0x6343,    0, 0x0000},
+        {0x5343,    0, 0x0000},
+        {0x3354,  266, 0x0100},
+        {0x4335,    0, 0x0000},
+        {0x3543,    0, 0x0000},
+        {0x3335,  273, 0x1000},
+        {0x3365,  274, 0x0200},
+        {0x4345,  275, 0x1000},
+        {0x3343,  276, 0x0200},
+        {0x3344,  277, 0x0200},
+        {0x3346,  278, 0x0200},
+        {0x3355,    0, 0x0000},
+        {0x5345,    0, 0x0000},
+        {0x6345,    0, 0x0000},
+        {0x3545,    0, 0x0000},
+        {0x3645,    0, 0x0000},
+        {0x3445,    0, 0x0000},
+        {0x5515,  291, 0x1EE6},
+        {0x3516,  308, 0x1FFE},
+        {0x3235,  354, 0x1EE7},
+        {0x2335,  396, 0x04EE},
+        {0x3315,  403, 0x1FE7},
+        {0x4514,  436, 0x1EFF},
+        {0x3245,  479, 0x1FD8},
+        {0x4234,  499, 0x0800},
+        {0x1545,  500, 0x12EF},
+        {0x2425,  524, 0x16CE},
+        {0x2434,  537, 0x0900},
+        {0x1335,  539, 0x0263},
+        {0x6661,    0, 0x0000},
+        {0x6651,    0, 0x0000},
+        {0x6616,    0, 0x0000},
+        {0x5661,  300, 0x0800},
+        {0x5651,  301, 0x0800},
+        {0x1516,  302, 0x1480},
+        {0x5561,    0, 0x0000},
+        {0x5551,    0, 0x0000},
+        {0x1516,  305, 0x1480},
+        {0x6561,    0, 0x0000},
+        {0x6551,    0, 0x0000},
+        {0x6615,    0, 0x0000},
+        {0x5616,    0, 0x0000},
+        {0x6516,    0, 0x0000},
+        {0x5615,    0, 0x0000},
+        {0x6515,    0, 0x0000},
+        {0x5516,    0, 0x0000},
+        {0x5255,    0, 0x0000},
+        {0x6255,  320, 0x1862},
+        {0x4651,  325, 0x0B00},
+        {0x5631,    0, 0x0000},
+        {0x6266,    0, 0x0000},
+        {0x4551,  328, 0x0072},
+        {0x1461,  332, 0x06EC},
+        {0x5613,  339, 0x0110},
+        {0x4515,  341, 0x0240},
+        {0x3551,  343, 0x1144},
+        {0x1113,  347, 0x0244},
+        {0x1145,  350, 0x004E},
+        {0x4661,    0, 0x0000},
+        {0x6461,    0, 0x0000},
+        {0x5451,    0, 0x0000},
+        {0x5265,    0, 0x0000},
+        {0x6265,    0, 0x0000},
+        {0x5461,    0, 0x0000},
+        {0x6631,    0, 0x0000},
+        {0x6451,    0, 0x0000},
+        {0x5266,    0, 0x0000},
+        {0x5415,    0, 0x0000},
+        {0x6256,    0, 0x0000},
+        {0x5256,    0, 0x0000},
+        {0x6613,    0, 0x0000},
+        {0x4615,    0, 0x0000},
+        {0x5531,    0, 0x0000},
+        {0x3631,    0, 0x0000},
+        {0x6415,    0, 0x0000},
+        {0x3661,    0, 0x0000},
+        {0x4561,    0, 0x0000},
+        {0x6531,    0, 0x0000},
+        {0x3651,    0, 0x0000},
+        {0x6416,    0, 0x0000},
+        {0x4616,    0, 0x0000},
+        {0x5416,    0, 0x0000},
+        {0x3613,    0, 0x0000},
+        {0x5513,    0, 0x0000},
+        {0x3531,    0, 0x0000},
+        {0x3561,    0, 0x0000},
+        {0x3615,    0, 0x0000},
+        {0x6513,    0, 0x0000},
+        {0x3616,    0, 0x0000},
+        {0x3513,    0, 0x0000},
+        {0x4516,    0, 0x0000},
+        {0x3515,    0, 0x0000},
+        {0x4416,  364, 0x0800},
+        {0x4613,  365, 0x0840},
+        {0x4513,  367, 0x0800},
+        {0x3416,  368, 0x0B50},
+        {0x3413,  373, 0x04AA},
+        {0x5263,  378, 0x1800},
+        {0x1336,  380, 0x02C7},
+        {0x3256,  386, 0x0C80},
+        {0x3253,  389, 0x0800},
+        {0x1536,  390, 0x02EC},
+        {0x4461,    0, 0x0000},
+        {0x4451,    0, 0x0000},
+        {0x6413,    0, 0x0000},
+        {0x5413,    0, 0x0000},
+        {0x4631,    0, 0x0000},
+        {0x4266,    0, 0x0000},
+        {0x6431,    0, 0x0000},
+        {0x4415,    0, 0x0000},
+        {0x3461,    0, 0x0000},
+        {0x4256,    0, 0x0000},
+        {0x4531,    0, 0x0000},
+        {0x6263,    0, 0x0000},
+        {0x5431,    0, 0x0000},
+        {0x3451,    0, 0x0000},
+        {0x6253,    0, 0x0000},
+        {0x5253,    0, 0x0000},
+        {0x4255,    0, 0x0000},
+        {0x4265,    0, 0x0000},
+        {0x3415,    0, 0x0000},
+        {0x3266,    0, 0x0000},
+        {0x3431,    0, 0x0000},
+        {0x6236,    0, 0x0000},
+        {0x6233,    0, 0x0000},
+        {0x3263,    0, 0x0000},
+        {0x5236,    0, 0x0000},
+        {0x5233,    0, 0x0000},
+        {0x3255,    0, 0x0000},
+        {0x3265,    0, 0x0000},
+        {0x3233,    0, 0x0000},
+        {0x5235,    0, 0x0000},
+        {0x6235,    0, 0x0000},
+        {0x3236,    0, 0x0000},
+        {0x4413,    0, 0x0000},
+        {0x4263,    0, 0x0000},
+        {0x4253,    0, 0x0000},
+        {0x4431,    0, 0x0000},
+        {0x4236,    0, 0x0000},
+        {0x4233,    0, 0x0000},
+        {0x4235,    0, 0x0000},
+        {0x2666,    0, 0x0000},
+        {0x2566,  414, 0x1804},
+        {0x5641,  417, 0x1800},
+        {0x6614,  419, 0x0063},
+        {0x5614,  423, 0x1804},
+        {0x5361,  426, 0x1C00},
+        {0x5331,    0, 0x0000},
+        {0x6316,    0, 0x0000},
+        {0x3331,  429, 0x10C0},
+        {0x3351,  432, 0x0100},
+        {0x3316,  433, 0x1600},
+        {0x6641,    0, 0x0000},
+        {0x2656,    0, 0x0000},
+        {0x2556,    0, 0x0000},
+        {0x6541,    0, 0x0000},
+        {0x5541,    0, 0x0000},
+        {0x2555,    0, 0x0000},
+        {0x2565,    0, 0x0000},
+        {0x2655,    0, 0x0000},
+        {0x2665,    0, 0x0000},
+        {0x6361,    0, 0x0000},
+        {0x6514,    0, 0x0000},
+        {0x5514,    0, 0x0000},
+        {0x6331,    0, 0x0000},
+        {0x6351,    0, 0x0000},
+        {0x5351,    0, 0x0000},
+        {0x5316,    0, 0x0000},
+        {0x6313,    0, 0x0000},
+        {0x3361,    0, 0x0000},
+        {0x5313,    0, 0x0000},
+        {0x5315,    0, 0x0000},
+        {0x6315,    0, 0x0000},
+        {0x3313,    0, 0x0000},
+        {0x2636,  448, 0x1800},
+        {0x2635,  450, 0x0844},
+        {0x2456,  453, 0x191C},
+        {0x6441,    0, 0x0000},
+        {0x5441,    0, 0x0000},
+        {0x1635,  459, 0x02CE},
+        {0x4361,  465, 0x1046},
+        {0x1356,  469, 0x040E},
+        {0x3614,  473, 0x0180},
+        {0x4315,  475, 0x0040},
+        {0x4541,  476, 0x0010},
+        {0x4414,  477, 0x1200},
+        {0x2663,    0, 0x0000},
+        {0x2633,    0, 0x0000},
+        {0x6246,    0, 0x0000},
+        {0x2466,    0, 0x0000},
+        {0x2653,    0, 0x0000},
+        {0x3641,    0, 0x0000},
+        {0x5245,    0, 0x0000},
+        {0x6245,    0, 0x0000},
+        {0x5246,    0, 0x0000},
+        {0x2465,    0, 0x0000},
+        {0x2455,    0, 0x0000},
+        {0x6264,    0, 0x0000},
+        {0x2553,    0, 0x0000},
+        {0x2563,    0, 0x0000},
+        {0x2533,    0, 0x0000},
+        {0x2536,    0, 0x0000},
+        {0x2535,    0, 0x0000},
+        {0x5254,    0, 0x0000},
+        {0x6254,    0, 0x0000},
+        {0x5264,    0, 0x0000},
+        {0x4331,    0, 0x0000},
+        {0x4441,    0, 0x0000},
+        {0x4641,    0, 0x0000},
+        {0x3541,    0, 0x0000},
+        {0x4351,    0, 0x0000},
+        {0x4313,    0, 0x0000},
+        {0x4316,    0, 0x0000},
+        {0x6414,    0, 0x0000},
+        {0x5414,    0, 0x0000},
+        {0x3514,    0, 0x0000},
+        {0x4614,    0, 0x0000},
+        {0x2436,  488, 0x1800},
+        {0x2453,    0, 0x0000},
+        {0x3414,  490, 0x0040},
+        {0x4254,  491, 0x0200},
+        {0x2435,  492, 0x0100},
+        {0x3441,  493, 0x0040},
+        {0x3234,  494, 0x1080},
+        {0x3254,  496, 0x0100},
+        {0x3243,  497, 0x1200},
+        {0x2463,    0, 0x0000},
+        {0x2433,    0, 0x0000},
+        {0x4264,    0, 0x0000},
+        {0x6234,    0, 0x0000},
+        {0x5234,    0, 0x0000},
+        {0x4246,    0, 0x0000},
+        {0x6243,    0, 0x0000},
+        {0x3264,    0, 0x0000},
+        {0x5243,    0, 0x0000},
+        {0x4245,    0, 0x0000},
+        {0x3246,    0, 0x0000},
+        {0x4243,    0, 0x0000},
+        {0x1136,  509, 0x0264},
+        {0x2353,  513, 0x1020},
+        {0x2654,  515, 0x0060},
+        {0x5314,    0, 0x0000},
+        {0x2335,  517, 0x1020},
+        {0x2564,  519, 0x0046},
+        {0x2554,  522, 0x0004},
+        {0x2546,  523, 0x0800},
+        {0x2545,    0, 0x0000},
+        {0x2363,    0, 0x0000},
+        {0x2333,    0, 0x0000},
+        {0x2366,    0, 0x0000},
+        {0x2336,    0, 0x0000},
+        {0x2664,    0, 0x0000},
+        {0x2356,    0, 0x0000},
+        {0x3314,    0, 0x0000},
+        {0x6314,    0, 0x0000},
+        {0x2646,    0, 0x0000},
+        {0x2365,    0, 0x0000},
+        {0x3341,    0, 0x0000},
+        {0x6341,    0, 0x0000},
+        {0x2355,    0, 0x0000},
+        {0x5341,    0, 0x0000},
+        {0x2645,    0, 0x0000},
+        {0x4314,  532, 0x0800},
+        {0x4244,  533, 0x1000},
+        {0x5244,    0, 0x0000},
+        {0x2634,  534, 0x0800},
+        {0x2534,  535, 0x0800},
+        {0x2446,  536, 0x0800},
+        {0x2454,    0, 0x0000},
+        {0x2445,    0, 0x0000},
+        {0x4341,    0, 0x0000},
+        {0x6244,    0, 0x0000},
+        {0x2643,    0, 0x0000},
+        {0x2543,    0, 0x0000},
+        {0x2464,    0, 0x0000},
+        {0x3244,    0, 0x0000},
+        {0x2443,    0, 0x0000},
+        {0x2444,  544, 0x1000},
+        {0x2544,    0, 0x0000},
+        {0x2346,  545, 0x0800},
+        {0x2343,  546, 0x0400},
+        {0x2334,  547, 0x0400},
+        {0x2644,    0, 0x0000},
+        {0x2364,    0, 0x0000},
+        {0x2354,    0, 0x0000},
+        {0x2345,    0, 0x0000},
+        {0x1515,  558, 0x0CC0},
+        {0x5215,  562, 0x1EE0},
+        {0x3215,  575, 0x1FE0},
+        {0x4213,  590, 0x0800},
+        {0x2256,  591, 0x1EC3},
+        {0x2415,  605, 0x1FF8},
+        {0x2413,  622, 0x0998},
+        {0x3315,  627, 0x16E7},
+        {0x2234,  641, 0x0A40},
+        {0x2314,  644, 0x0A00},
+        {0x6611,    0, 0x0000},
+        {0x5611,    0, 0x0000},
+        {0x6511,    0, 0x0000},
+        {0x5511,    0, 0x0000},
+        {0x3611,  569, 0x1400},
+        {0x3511,  571, 0x1020},
+        {0x6251,    0, 0x0000},
+        {0x5411,  573, 0x0020},
+        {0x5261,    0, 0x0000},
+        {0x5251,    0, 0x0000},
+        {0x5216,  574, 0x0800},
+        {0x6411,    0, 0x0000},
+        {0x4611,    0, 0x0000},
+        {0x6261,    0, 0x0000},
+        {0x4511,    0, 0x0000},
+        {0x6216,    0, 0x0000},
+        {0x6215,    0, 0x0000},
+        {0x4411,    0, 0x0000},
+        {0x4261,    0, 0x0000},
+        {0x4251,  583, 0x0200},
+        {0x5231,    0, 0x0000},
+        {0x3411,  584, 0x0040},
+        {0x3231,  585, 0x1080},
+        {0x3251,  587, 0x0100},
+        {0x3213,  588, 0x1200},
+        {0x6231,    0, 0x0000},
+        {0x4216,    0, 0x0000},
+        {0x6213,    0, 0x0000},
+        {0x3261,    0, 0x0000},
+        {0x5213,    0, 0x0000},
+        {0x4215,    0, 0x0000},
+        {0x3216,    0, 0x0000},
+        {0x4231,    0, 0x0000},
+        {0x3311,    0, 0x0000},
+        {0x5311,  599, 0x1000},
+        {0x2515,  600, 0x0040},
+        {0x2561,  601, 0x0100},
+        {0x2551,  602, 0x0040},
+        {0x2516,  603, 0x0100},
+        {0x2265,    0, 0x0000},
+        {0x2255,  604, 0x0200},
+        {0x6311,    0, 0x0000},
+        {0x2661,    0, 0x0000},
+        {0x2615,    0, 0x0000},
+        {0x2616,    0, 0x0000},
+        {0x2651,    0, 0x0000},
+        {0x2266,    0, 0x0000},
+        {0x6241,    0, 0x0000},
+        {0x5241,    0, 0x0000},
+        {0x2236,  615, 0x1800},
+        {0x2253,  617, 0x0042},
+        {0x2531,  619, 0x0004},
+        {0x5214,    0, 0x0000},
+        {0x2235,  620, 0x0040},
+        {0x2461,  621, 0x0040},
+        {0x2451,    0, 0x0000},
+        {0x2416,    0, 0x0000},
+        {0x2263,    0, 0x0000},
+        {0x2233,    0, 0x0000},
+        {0x4311,    0, 0x0000},
+        {0x2631,    0, 0x0000},
+        {0x6214,    0, 0x0000},
+        {0x2613,    0, 0x0000},
+        {0x2513,    0, 0x0000},
+        {0x4241,    0, 0x0000},
+        {0x3241,    0, 0x0000},
+        {0x4214,    0, 0x0000},
+        {0x3214,    0, 0x0000},
+        {0x2431,    0, 0x0000},
+        {0x2246,  636, 0x0800},
+        {0x2254,  637, 0x0040},
+        {0x2541,    0, 0x0000},
+        {0x2245,  638, 0x0040},
+        {0x2361,  639, 0x0040},
+        {0x2331,  640, 0x1000},
+        {0x2316,    0, 0x0000},
+        {0x2313,    0, 0x0000},
+        {0x2315,    0, 0x0000},
+        {0x2264,    0, 0x0000},
+        {0x2641,    0, 0x0000},
+        {0x2614,    0, 0x0000},
+        {0x2514,    0, 0x0000},
+        {0x2351,    0, 0x0000},
+        {0x2441,    0, 0x0000},
+        {0x2414,    0, 0x0000},
+        {0x2243,    0, 0x0000},
+        {0x2244,    0, 0x0000},
+        {0x2341,    0, 0x0000},
+        {0x1145,  653, 0x0046},
+        {0x1415,  656, 0x04C2},
+        {0x2311,    0, 0x0000},
+        {0x1145,  660, 0x0046},
+        {0x4115,  663, 0x04C0},
+        {0x3211,    0, 0x0000},
+        {0x2213,    0, 0x0000},
+        {0x2261,    0, 0x0000},
+        {0x2251,    0, 0x0000},
+        {0x2241,    0, 0x0000},
+        {0x2231,    0, 0x0000},
+        {0x2611,    0, 0x0000},
+        {0x2511,    0, 0x0000},
+        {0x2411,    0, 0x0000},
+        {0x2216,    0, 0x0000},
+        {0x2214,    0, 0x0000},
+        {0x2215,    0, 0x0000},
+        {0x6211,    0, 0x0000},
+        {0x5211,    0, 0x0000},
+        {0x4211,    0, 0x0000},
+        {0x5525,  678, 0x1EE6},
+        {0x3526,  695, 0x1FFE},
+        {0x3135,  741, 0x1EE7},
+        {0x1335,  783, 0x04EE},
+        {0x3325,  790, 0x1FE7},
+        {0x4524,  823, 0x1EFF},
+        {0x3145,  866, 0x1FD8},
+        {0x4134,  886, 0x0800},
+        {0x1415,  887, 0x06E6},
+        {0x1415,  912, 0x16CE},
+        {0x1434,  925, 0x0900},
+        {0x1335,  927, 0x1660},
+        {0x6662,    0, 0x0000},
+        {0x6652,    0, 0x0000},
+        {0x6626,    0, 0x0000},
+        {0x5662,  687, 0x0800},
+        {0x5652,  688, 0x0800},
+        {0x1516,  689, 0x0244},
+        {0x5562,    0, 0x0000},
+        {0x5552,    0, 0x0000},
+        {0x1516,  692, 0x0244},
+        {0x6562,    0, 0x0000},
+        {0x6552,    0, 0x0000},
+        {0x6625,    0, 0x0000},
+        {0x5626,    0, 0x0000},
+        {0x6526,    0, 0x0000},
+        {0x5625,    0, 0x0000},
+        {0x6525,    0, 0x0000},
+        {0x5526,    0, 0x0000},
+        {0x5155,    0, 0x0000},
+        {0x6155,  707, 0x1862},
+        {0x4652,  712, 0x0B00},
+        {0x5632,    0, 0x0000},
+        {0x6166,    0, 0x0000},
+        {0x4552,  715, 0x0072},
+        {0x1462,  719, 0x06EC},
+        {0x5623,  726, 0x0110},
+        {0x4525,  728, 0x0240},
+        {0x3552,  730, 0x1144},
+        {0x1123,  734, 0x0244},
+        {0x1145,  737, 0x0027},
+        {0x4662,    0, 0x0000},
+        {0x6462,    0, 0x0000},
+        {0x5452,    0, 0x0000},
+        {0x5165,    0, 0x0000},
+        {0x6165,    0, 0x0000},
+        {0x5462,    0, 0x0000},
+        {0x6632,    0, 0x0000},
+        {0x6452,    0, 0x0000},
+        {0x5166,    0, 0x0000},
+        {0x5425,    0, 0x0000},
+        {0x6156,    0, 0x0000},
+        {0x5156,    0, 0x0000},
+        {0x6623,    0, 0x0000},
+        {0x4625,    0, 0x0000},
+        {0x5532,    0, 0x0000},
+        {0x3632,    0, 0x0000},
+        {0x6425,    0, 0x0000},
+        {0x3662,    0, 0x0000},
+        {0x4562,    0, 0x0000},
+        {0x6532,    0, 0x0000},
+        {0x3652,    0, 0x0000},
+        {0x6426,    0, 0x0000},
+        {0x4626,    0, 0x0000},
+        {0x5426,    0, 0x0000},
+        {0x3623,    0, 0x0000},
+        {0x5523,    0, 0x0000},
+        {0x3532,    0, 0x0000},
+        {0x3562,    0, 0x0000},
+        {0x3625,    0, 0x0000},
+        {0x6523,    0, 0x0000},
+        {0x3626,    0, 0x0000},
+        {0x3523,    0, 0x0000},
+        {0x4526,    0, 0x0000},
+        {0x3525,    0, 0x0000},
+        {0x4426,  751, 0x0800},
+        {0x4623,  752, 0x0840},
+        {0x4523,  754, 0x0800},
+        {0x3426,  755, 0x0B50},
+        {0x3423,  760, 0x04AA},
+        {0x5163,  765, 0x1800},
+        {0x1436,  767, 0x06CC},
+        {0x3156,  773, 0x0C80},
+        {0x3153,  776, 0x0800},
+        {0x1536,  777, 0x05D8},
+        {0x4462,    0, 0x0000},
+        {0x4452,    0, 0x0000},
+        {0x6423,    0, 0x0000},
+        {0x5423,    0, 0x0000},
+        {0x4632,    0, 0x0000},
+        {0x4166,    0, 0x0000},
+        {0x6432,    0, 0x0000},
+        {0x4425,    0, 0x0000},
+        {0x3462,    0, 0x0000},
+        {0x4156,    0, 0x0000},
+        {0x4532,    0, 0x0000},
+        {0x6163,    0, 0x0000},
+        {0x5432,    0, 0x0000},
+        {0x3452,    0, 0x0000},
+        {0x6153,    0, 0x0000},
+        {0x5153,    0, 0x0000},
+        {0x4155,    0, 0x0000},
+        {0x4165,    0, 0x0000},
+        {0x3425,    0, 0x0000},
+        {0x3166,    0, 0x0000},
+        {0x3432,    0, 0x0000},
+        {0x6136,    0, 0x0000},
+        {0x6133,    0, 0x0000},
+        {0x3163,    0, 0x0000},
+        {0x5136,    0, 0x0000},
+        {0x5133,    0, 0x0000},
+        {0x3155,    0, 0x0000},
+        {0x3165,    0, 0x0000},
+        {0x3133,    0, 0x0000},
+        {0x5135,    0, 0x0000},
+        {0x6135,    0, 0x0000},
+        {0x3136,    0, 0x0000},
+        {0x4423,    0, 0x0000},
+        {0x4163,    0, 0x0000},
+        {0x4153,    0, 0x0000},
+        {0x4432,    0, 0x0000},
+        {0x4136,    0, 0x0000},
+        {0x4133,    0, 0x0000},
+        {0x4135,    0, 0x0000},
+        {0x1666,    0, 0x0000},
+        {0x1566,  801, 0x1804},
+        {0x5642,  804, 0x1800},
+        {0x6624,  806, 0x0063},
+        {0x5624,  810, 0x1804},
+        {0x5362,  813, 0x1C00},
+        {0x5332,    0, 0x0000},
+        {0x6326,    0, 0x0000},
+        {0x3332,  816, 0x10C0},
+        {0x3352,  819, 0x0100},
+        {0x3326,  820, 0x1600},
+        {0x6642,    0, 0x0000},
+        {0x1656,    0, 0x0000},
+        {0x1556,    0, 0x0000},
+        {0x6542,    0, 0x0000},
+        {0x5542,    0, 0x0000},
+        {0x1555,    0, 0x0000},
+        {0x1565,    0, 0x0000},
+        {0x1655,    0, 0x0000},
+        {0x1665,    0, 0x0000},
+        {0x6362,    0, 0x0000},
+        {0x6524,    0, 0x0000},
+        {0x5524,    0, 0x0000},
+        {0x6332,    0, 0x0000},
+        {0x6352,    0, 0x0000},
+        {0x5352,    0, 0x0000},
+        {0x5326,    0, 0x0000},
+        {0x6323,    0, 0x0000},
+        {0x3362,    0, 0x0000},
+        {0x5323,    0, 0x0000},
+        {0x5325,    0, 0x0000},
+        {0x6325,    0, 0x0000},
+        {0x3323,    0, 0x0000},
+        {0x1636,  835, 0x1800},
+        {0x1635,  837, 0x0844},
+        {0x1456,  840, 0x191C},
+        {0x6442,    0, 0x0000},
+        {0x5442,    0, 0x0000},
+        {0x1336,  846, 0x16C4},
+        {0x4362,  852, 0x1046},
+        {0x1356,  856, 0x0207},
+        {0x3624,  860, 0x0180},
+        {0x4325,  862, 0x0040},
+        {0x4542,  863, 0x0010},
+        {0x4424,  864, 0x1200},
+        {0x1663,    0, 0x0000},
+        {0x1633,    0, 0x0000},
+        {0x6146,    0, 0x0000},
+        {0x1466,    0, 0x0000},
+        {0x1653,    0, 0x0000},
+        {0x3642,    0, 0x0000},
+        {0x5145,    0, 0x0000},
+        {0x6145,    0, 0x0000},
+        {0x5146,    0, 0x0000},
+        {0x1465,    0, 0x0000},
+        {0x1455,    0, 0x0000},
+        {0x6164,    0, 0x0000},
+        {0x1553,    0, 0x0000},
+        {0x1563,    0, 0x0000},
+        {0x1535,    0, 0x0000},
+        {0x1533,    0, 0x0000},
+        {0x1536,    0, 0x0000},
+        {0x5154,    0, 0x0000},
+        {0x6154,    0, 0x0000},
+        {0x5164,    0, 0x0000},
+        {0x4332,    0, 0x0000},
+        {0x4442,    0, 0x0000},
+        {0x4642,    0, 0x0000},
+        {0x3542,    0, 0x0000},
+        {0x4352,    0, 0x0000},
+        {0x4323,    0, 0x0000},
+        {0x4326,    0, 0x0000},
+        {0x6424,    0, 0x0000},
+        {0x5424,    0, 0x0000},
+        {0x3524,    0, 0x0000},
+        {0x4624,    0, 0x0000},
+        {0x1436,  875, 0x1800},
+        {0x1453,    0, 0x0000},
+        {0x3424,  877, 0x0040},
+        {0x4154,  878, 0x0200},
+        {0x1435,  879, 0x0100},
+        {0x3442,  880, 0x0040},
+        {0x3134,  881, 0x1080},
+        {0x3154,  883, 0x0100},
+        {0x3143,  884, 0x1200},
+        {0x1463,    0, 0x0000},
+        {0x1433,    0, 0x0000},
+        {0x4164,    0, 0x0000},
+        {0x6134,    0, 0x0000},
+        {0x5134,    0, 0x0000},
+        {0x4146,    0, 0x0000},
+        {0x6143,    0, 0x0000},
+        {0x3164,    0, 0x0000},
+        {0x5143,    0, 0x0000},
+        {0x4145,    0, 0x0000},
+        {0x3146,    0, 0x0000},
+        {0x4143,    0, 0x0000},
+        {0x3324,  894, 0x1880},
+        {0x5324,  897, 0x0800},
+        {0x1136,  898, 0x1680},
+        {0x1356,  902, 0x1240},
+        {0x1546,  905, 0x0D00},
+        {0x1136,  908, 0x02C0},
+        {0x1545,  911, 0x1000},
+        {0x6342,    0, 0x0000},
+        {0x3342,    0, 0x0000},
+        {0x6324,    0, 0x0000},
+        {0x5342,    0, 0x0000},
+        {0x1363,    0, 0x0000},
+        {0x1333,    0, 0x0000},
+        {0x1366,    0, 0x0000},
+        {0x1336,    0, 0x0000},
+        {0x1664,    0, 0x0000},
+        {0x1646,    0, 0x0000},
+        {0x1353,    0, 0x0000},
+        {0x1654,    0, 0x0000},
+        {0x1554,    0, 0x0000},
+        {0x1564,    0, 0x0000},
+        {0x1355,    0, 0x0000},
+        {0x1365,    0, 0x0000},
+        {0x1335,    0, 0x0000},
+        {0x1645,    0, 0x0000},
+        {0x4324,  920, 0x0800},
+        {0x4144,  921, 0x1000},
+        {0x5144,    0, 0x0000},
+        {0x1634,  922, 0x0800},
+        {0x1534,  923, 0x0800},
+        {0x1446,  924, 0x0800},
+        {0x1454,    0, 0x0000},
+        {0x1445,    0, 0x0000},
+        {0x4342,    0, 0x0000},
+        {0x6144,    0, 0x0000},
+        {0x1643,    0, 0x0000},
+        {0x1543,    0, 0x0000},
+        {0x1464,    0, 0x0000},
+        {0x3144,    0, 0x0000},
+        {0x1443,    0, 0x0000},
+        {0x1444,  932, 0x1000},
+        {0x1544,    0, 0x0000},
+        {0x1346,  933, 0x0800},
+        {0x1343,  934, 0x0400},
+        {0x1334,  935, 0x0400},
+        {0x1644,    0, 0x0000},
+        {0x1364,    0, 0x0000},
+        {0x1354,    0, 0x0000},
+        {0x1345,    0, 0x0000},
+        {0x2525,  948, 0x1EDC},
+        {0x2352,  967, 0x1FFE},
+        {0x3521, 1004, 0x1EDC},
+        {0x1312, 1027, 0x1488},
+        {0x1256, 1031, 0x18F6},
+        {0x1516, 1052, 0x1FDD},
+        {0x1315, 1083, 0x1FDC},
+        {0x1341, 1118, 0x0910},
+        {0x1235, 1121, 0x1E8C},
+        {0x1315, 1132, 0x07D8},
+        {0x1314, 1144, 0x0910},
+        {0x1234, 1147, 0x0800},
+        {0x6262,    0, 0x0000},
+        {0x5262,  957, 0x0800},
+        {0x5252,    0, 0x0000},
+        {0x2262,  958, 0x1080},
+        {0x2252,  960, 0x1080},
+        {0x2226,  962, 0x1000},
+        {0x2562,  963, 0x0010},
+        {0x2552,  964, 0x0010},
+        {0x2225,  965, 0x1400},
+        {0x6252,    0, 0x0000},
+        {0x6226,    0, 0x0000},
+        {0x2662,    0, 0x0000},
+        {0x5226,    0, 0x0000},
+        {0x2652,    0, 0x0000},
+        {0x2626,    0, 0x0000},
+        {0x6225,    0, 0x0000},
+        {0x5225,    0, 0x0000},
+        {0x2526,    0, 0x0000},
+        {0x2625,    0, 0x0000},
+        {0x6621,    0, 0x0000},
+        {0x5621,  979, 0x1840},
+        {0x3226,  982, 0x1A00},
+        {0x3225,  985, 0x0800},
+        {0x6612,    0, 0x0000},
+        {0x6242,  986, 0x1A70},
+        {0x2223,  992, 0x12C0},
+        {0x2523,    0, 0x0000},
+        {0x2462,  996, 0x1C00},
+        {0x2323,  999, 0x1044},
+        {0x2325, 1002, 0x0010},
+        {0x2362, 1003, 0x0200},
+        {0x4226,    0, 0x0000},
+        {0x6521,    0, 0x0000},
+        {0x5521,    0, 0x0000},
+        {0x4225,    0, 0x0000},
+        {0x6223,    0, 0x0000},
+        {0x3223,    0, 0x0000},
+        {0x5223,    0, 0x0000},
+        {0x2426,    0, 0x0000},
+        {0x5512,    0, 0x0000},
+        {0x5612,    0, 0x0000},
+        {0x6512,    0, 0x0000},
+        {0x4262,    0, 0x0000},
+        {0x4242,    0, 0x0000},
+        {0x5242,    0, 0x0000},
+        {0x3262,    0, 0x0000},
+        {0x2425,    0, 0x0000},
+        {0x2623,    0, 0x0000},
+        {0x2242,    0, 0x0000},
+        {0x2642,    0, 0x0000},
+        {0x2442,    0, 0x0000},
+        {0x4252,    0, 0x0000},
+        {0x2542,    0, 0x0000},
+        {0x2326,    0, 0x0000},
+        {0x3252,    0, 0x0000},
+        {0x2452,    0, 0x0000},
+        {0x4612, 1013, 0x1840},
+        {0x5412, 1016, 0x0200},
+        {0x5312,    0, 0x0000},
+        {0x2423, 1017, 0x0810},
+        {0x3312, 1019, 0x1200},
+        {0x4621, 1021, 0x1800},
+        {0x5421, 1023, 0x0200},
+        {0x3512, 1024, 0x0010},
+        {0x3321, 1025, 0x1200},
+        {0x2342,    0, 0x0000},
+        {0x6412,    0, 0x0000},
+        {0x4412,    0, 0x0000},
+        {0x6312,    0, 0x0000},
+        {0x3242,    0, 0x0000},
+        {0x4223,    0, 0x0000},
+        {0x4512,    0, 0x0000},
+        {0x3612,    0, 0x0000},
+        {0x6421,    0, 0x0000},
+        {0x4421,    0, 0x0000},
+        {0x6321,    0, 0x0000},
+        {0x5321,    0, 0x0000},
+        {0x4521,    0, 0x0000},
+        {0x3621,    0, 0x0000},
+        {0x3421,    0, 0x0000},
+        {0x4321,    0, 0x0000},
+        {0x3412,    0, 0x0000},
+        {0x4312,    0, 0x0000},
+        {0x2332, 1039, 0x0040},
+        {0x2524, 1040, 0x1440},
+        {0x2165,    0, 0x0000},
+        {0x2224, 1043, 0x1440},
+        {0x5224, 1046, 0x1440},
+        {0x2155, 1049, 0x0200},
+        {0x1265, 1050, 0x0010},
+        {0x1255, 1051, 0x0200},
+        {0x2424,    0, 0x0000},
+        {0x2632,    0, 0x0000},
+        {0x2532,    0, 0x0000},
+        {0x2624,    0, 0x0000},
+        {0x3232,    0, 0x0000},
+        {0x2232,    0, 0x0000},
+        {0x4224,    0, 0x0000},
+        {0x6232,    0, 0x0000},
+        {0x5232,    0, 0x0000},
+        {0x6224,    0, 0x0000},
+        {0x2166,    0, 0x0000},
+        {0x2156,    0, 0x0000},
+        {0x1266,    0, 0x0000},
+        {0x2324, 1063, 0x0910},
+        {0x2145, 1066, 0x0600},
+        {0x5151, 1068, 0x0200},
+        {0x5161, 1069, 0x0800},
+        {0x1245, 1070, 0x0680},
+        {0x1661, 1073, 0x00C4},
+        {0x1651, 1076, 0x0010},
+        {0x1246,    0, 0x0000},
+        {0x1551, 1077, 0x0204},
+        {0x1561, 1079, 0x0110},
+        {0x1511, 1081, 0x1200},
+        {0x4232,    0, 0x0000},
+        {0x2432,    0, 0x0000},
+        {0x3224,    0, 0x0000},
+        {0x2163,    0, 0x0000},
+        {0x2153,    0, 0x0000},
+        {0x6161,    0, 0x0000},
+        {0x6151,    0, 0x0000},
+        {0x2146,    0, 0x0000},
+        {0x1263,    0, 0x0000},
+        {0x1253,    0, 0x0000},
+        {0x5115,    0, 0x0000},
+        {0x5111,    0, 0x0000},
+        {0x6111,    0, 0x0000},
+        {0x6115,    0, 0x0000},
+        {0x6116,    0, 0x0000},
+        {0x1611,    0, 0x0000},
+        {0x5116,    0, 0x0000},
+        {0x1615,    0, 0x0000},
+        {0x1616,    0, 0x0000},
+        {0x1515,    0, 0x0000},
+        {0x4161, 1093, 0x1840},
+        {0x4151, 1096, 0x0A00},
+        {0x3151,    0, 0x0000},
+        {0x1461, 1098, 0x18D0},
+        {0x6451, 1103, 0x10E6},
+        {0x5113,    0, 0x0000},
+        {0x1411, 1109, 0x1000},
+        {0x1361, 1110, 0x0104},
+        {0x1351, 1112, 0x0110},
+        {0x1113, 1114, 0x1E00},
+        {0x2143,    0, 0x0000},
+        {0x6141,    0, 0x0000},
+        {0x4141,    0, 0x0000},
+        {0x3161,    0, 0x0000},
+        {0x5141,    0, 0x0000},
+        {0x4116,    0, 0x0000},
+        {0x1243,    0, 0x0000},
+        {0x4111,    0, 0x0000},
+        {0x1641,    0, 0x0000},
+        {0x1441,    0, 0x0000},
+        {0x3113,    0, 0x0000},
+        {0x3116,    0, 0x0000},
+        {0x3111,    0, 0x0000},
+        {0x6113,    0, 0x0000},
+        {0x1541,    0, 0x0000},
+        {0x1451,    0, 0x0000},
+        {0x1416,    0, 0x0000},
+        {0x4115,    0, 0x0000},
+        {0x1613,    0, 0x0000},
+        {0x3115,    0, 0x0000},
+        {0x1513,    0, 0x0000},
+        {0x1415,    0, 0x0000},
+        {0x1316,    0, 0x0000},
+        {0x1311,    0, 0x0000},
+        {0x1313,    0, 0x0000},
+        {0x4113,    0, 0x0000},
+        {0x1413,    0, 0x0000},
+        {0x3141,    0, 0x0000},
+        {0x2144, 1128, 0x1000},
+        {0x2154,    0, 0x0000},
+        {0x2133, 1129, 0x1000},
+        {0x1244, 1130, 0x1000},
+        {0x1254,    0, 0x0000},
+        {0x2135,    0, 0x0000},
+        {0x1233, 1131, 0x1000},
+        {0x2164,    0, 0x0000},
+        {0x2136,    0, 0x0000},
+        {0x1264,    0, 0x0000},
+        {0x1236,    0, 0x0000},
+        {0x3131, 1139, 0x1000},
+        {0x5131,    0, 0x0000},
+        {0x4114, 1140, 0x1000},
+        {0x1631, 1141, 0x0004},
+        {0x1531,    0, 0x0000},
+        {0x1414, 1142, 0x1000},
+        {0x1331, 1143, 0x0040},
+        {0x6131,    0, 0x0000},
+        {0x6114,    0, 0x0000},
+        {0x5114,    0, 0x0000},
+        {0x1614,    0, 0x0000},
+        {0x1514,    0, 0x0000},
+        {0x4131,    0, 0x0000},
+        {0x1431,    0, 0x0000},
+        {0x3114,    0, 0x0000},
+        {0x2134,    0, 0x0000},
+        {0x1415, 1157, 0x0046},
+        {0x1145, 1160, 0x04C2},
+        {0x2131,    0, 0x0000},
+        {0x2412, 1164, 0x1098},
+        {0x1114, 1170, 0x1622},
+        {0x1145, 1176, 0x0006},
+        {0x1145, 1180, 0x04C2},
+        {0x1231, 1184, 0x0010},
+        {0x1114, 1185, 0x1600},
+        {0x2621,    0, 0x0000},
+        {0x2521,    0, 0x0000},
+        {0x2421,    0, 0x0000},
+        {0x2321,    0, 0x0000},
+        {0x2161,    0, 0x0000},
+        {0x2151,    0, 0x0000},
+        {0x2141,    0, 0x0000},
+        {0x5221, 1168, 0x1000},
+        {0x4221,    0, 0x0000},
+        {0x2221,    0, 0x0000},
+        {0x2512, 1169, 0x1000},
+        {0x6221,    0, 0x0000},
+        {0x2612,    0, 0x0000},
+        {0x3221,    0, 0x0000},
+        {0x2312,    0, 0x0000},
+        {0x2115, 1175, 0x1000},
+        {0x2111,    0, 0x0000},
+        {0x2114,    0, 0x0000},
+        {0x2116,    0, 0x0000},
+        {0x2212, 1178, 0x1000},
+        {0x4212, 1179, 0x1000},
+        {0x6212,    0, 0x0000},
+        {0x5212,    0, 0x0000},
+        {0x3212,    0, 0x0000},
+        {0x1261,    0, 0x0000},
+        {0x1251,    0, 0x0000},
+        {0x1241,    0, 0x0000},
+        {0x2113,    0, 0x0000},
+        {0x1215, 1188, 0x1000},
+        {0x1211,    0, 0x0000},
+        {0x1214,    0, 0x0000},
+        {0x1216,    0, 0x0000},
+        {0x2515, 1201, 0x02E6},
+        {0x1325, 1207, 0x06EC},
+        {0x1325, 1228, 0x0FDC},
+        {0x3142, 1244, 0x0100},
+        {0x1315, 1245, 0x16C3},
+        {0x2156, 1257, 0x03FA},
+        {0x1352, 1273, 0x1FCC},
+        {0x1323, 1293, 0x1488},
+        {0x1536, 1297, 0x1660},
+        {0x3526, 1305, 0x02EC},
+        {0x1324, 1311, 0x0100},
+        {0x1134,    0, 0x0000},
+        {0x6622,    0, 0x0000},
+        {0x5622,    0, 0x0000},
+        {0x2622,    0, 0x0000},
+        {0x6522,    0, 0x0000},
+        {0x5522,    0, 0x0000},
+        {0x2522,    0, 0x0000},
+        {0x6162,    0, 0x0000},
+        {0x5162, 1214, 0x1800},
+        {0x4622, 1216, 0x1C00},
+        {0x4522, 1219, 0x0A20},
+        {0x3522, 1222, 0x0040},
+        {0x2116, 1223, 0x0026},
+        {0x5125, 1226, 0x1200},
+        {0x6152,    0, 0x0000},
+        {0x5152,    0, 0x0000},
+        {0x2422,    0, 0x0000},
+        {0x6422,    0, 0x0000},
+        {0x4422,    0, 0x0000},
+        {0x6126,    0, 0x0000},
+        {0x3622,    0, 0x0000},
+        {0x5422,    0, 0x0000},
+        {0x5126,    0, 0x0000},
+        {0x3322,    0, 0x0000},
+        {0x6322,    0, 0x0000},
+        {0x2322,    0, 0x0000},
+        {0x5322,    0, 0x0000},
+        {0x6125,    0, 0x0000},
+        {0x4162, 1237, 0x1800},
+        {0x4152, 1239, 0x0A00},
+        {0x3152,    0, 0x0000},
+        {0x3422, 1241, 0x0040},
+        {0x3126, 1242, 0x1800},
+        {0x5123,    0, 0x0000},
+        {0x4322,    0, 0x0000},
+        {0x4125,    0, 0x0000},
+        {0x3125,    0, 0x0000},
+        {0x6142,    0, 0x0000},
+        {0x4142,    0, 0x0000},
+        {0x3162,    0, 0x0000},
+        {0x5142,    0, 0x0000},
+        {0x4126,    0, 0x0000},
+        {0x6123,    0, 0x0000},
+        {0x3123,    0, 0x0000},
+        {0x4123,    0, 0x0000},
+        {0x2222, 1252, 0x1000},
+        {0x5222,    0, 0x0000},
+        {0x1161, 1253, 0x1000},
+        {0x1151, 1254, 0x1000},
+        {0x1111, 1255, 0x1000},
+        {0x1155, 1256, 0x1000},
+        {0x1115,    0, 0x0000},
+        {0x6222,    0, 0x0000},
+        {0x1166,    0, 0x0000},
+        {0x1156,    0, 0x0000},
+        {0x1116,    0, 0x0000},
+        {0x1165,    0, 0x0000},
+        {0x3222, 1265, 0x1000},
+        {0x1525, 1266, 0x0040},
+        {0x1562, 1267, 0x0100},
+        {0x1113, 1268, 0x0400},
+        {0x1145, 1269, 0x0200},
+        {0x1552, 1270, 0x0040},
+        {0x1526, 1271, 0x0100},
+        {0x1146, 1272, 0x0200},
+        {0x4222,    0, 0x0000},
+        {0x1662,    0, 0x0000},
+        {0x1625,    0, 0x0000},
+        {0x1141,    0, 0x0000},
+        {0x1163,    0, 0x0000},
+        {0x1626,    0, 0x0000},
+        {0x1652,    0, 0x0000},
+        {0x1153,    0, 0x0000},
+        {0x4124, 1282, 0x1000},
+        {0x5124,    0, 0x0000},
+        {0x1143, 1283, 0x0040},
+        {0x1623, 1284, 0x0218},
+        {0x1523, 1287, 0x0010},
+        {0x1462, 1288, 0x1800},
+        {0x1323, 1290, 0x1040},
+        {0x1325,    0, 0x0000},
+        {0x1362, 1292, 0x0200},
+        {0x6124,    0, 0x0000},
+        {0x1426,    0, 0x0000},
+        {0x3132,    0, 0x0000},
+        {0x6132,    0, 0x0000},
+        {0x1425,    0, 0x0000},
+        {0x5132,    0, 0x0000},
+        {0x1642,    0, 0x0000},
+        {0x1442,    0, 0x0000},
+        {0x1542,    0, 0x0000},
+        {0x1326,    0, 0x0000},
+        {0x1452,    0, 0x0000},
+        {0x4132,    0, 0x0000},
+        {0x3124,    0, 0x0000},
+        {0x1342,    0, 0x0000},
+        {0x1423,    0, 0x0000},
+        {0x1114, 1302, 0x1000},
+        {0x1154, 1303, 0x1000},
+        {0x1131, 1304, 0x1000},
+        {0x1135,    0, 0x0000},
+        {0x1136,    0, 0x0000},
+        {0x1144,    0, 0x0000},
+        {0x1164,    0, 0x0000},
+        {0x1133,    0, 0x0000},
+        {0x1332,    0, 0x0000},
+        {0x1632,    0, 0x0000},
+        {0x1424,    0, 0x0000},
+        {0x1624,    0, 0x0000},
+        {0x1532,    0, 0x0000},
+        {0x1524,    0, 0x0000},
+        {0x1432,    0, 0x0000},
+        {0x4115, 1321, 0x1600},
+        {0x2145, 1324, 0x1640},
+        {0x2132,    0, 0x0000},
+        {0x4512, 1328, 0x168C},
+        {0x2145, 1334, 0x1644},
+        {0x1415, 1339, 0x04C0},
+        {0x1245, 1342, 0x1640},
+        {0x1232, 1346, 0x0010},
+        {0x1145, 1347, 0x0260},
+        {0x6112,    0, 0x0000},
+        {0x5112,    0, 0x0000},
+        {0x4112,    0, 0x0000},
+        {0x3112,    0, 0x0000},
+        {0x2162,    0, 0x0000},
+        {0x2152,    0, 0x0000},
+        {0x2142,    0, 0x0000},
+        {0x6121,    0, 0x0000},
+        {0x5121,    0, 0x0000},
+        {0x4121,    0, 0x0000},
+        {0x1612,    0, 0x0000},
+        {0x1412,    0, 0x0000},
+        {0x1512,    0, 0x0000},
+        {0x1312,    0, 0x0000},
+        {0x3121,    0, 0x0000},
+        {0x2126,    0, 0x0000},
+        {0x2124,    0, 0x0000},
+        {0x2125,    0, 0x0000},
+        {0x1621,    0, 0x0000},
+        {0x1521,    0, 0x0000},
+        {0x1421,    0, 0x0000},
+        {0x1321,    0, 0x0000},
+        {0x1262,    0, 0x0000},
+        {0x1252,    0, 0x0000},
+        {0x1242,    0, 0x0000},
+        {0x2123,    0, 0x0000},
+        {0x1226,    0, 0x0000},
+        {0x1224,    0, 0x0000},
+        {0x1225,    0, 0x0000},
+        {0x2121,    0, 0x0000},
+        {0x2112,    0, 0x0000},
+        {0x1221,    0, 0x0000},
+        {0x1212,    0, 0x0000},
+        {0x1114, 1361, 0x1600},
+        {0x1145, 1365, 0x0260},
+        {0x3122,    0, 0x0000},
+        {0x1114, 1370, 0x1600},
+        {0x1415, 1374, 0x0260},
+        {0x1322,    0, 0x0000},
+        {0x1123, 1377, 0x0200},
+        {0x1152, 1364, 0x1000},
+        {0x1142,    0, 0x0000},
+        {0x1112,    0, 0x0000},
+        {0x1162,    0, 0x0000},
+        {0x2122, 1368, 0x1000},
+        {0x4122, 1369, 0x1000},
+        {0x1132,    0, 0x0000},
+        {0x6122,    0, 0x0000},
+        {0x5122,    0, 0x0000},
+        {0x1125, 1373, 0x1000},
+        {0x1121,    0, 0x0000},
+        {0x1124,    0, 0x0000},
+        {0x1126,    0, 0x0000},
+        {0x1622,    0, 0x0000},
+        {0x1522,    0, 0x0000},
+        {0x1422,    0, 0x0000},
+        {0x1222,    0, 0x0000}
+};
+
+#endif /* DECISION_TREE_AVAILABLE */
@@ -0,0 +1,46 @@
+#ifndef DECISION_TREE_H_
+#define DECISION_TREE_H_
+/**
+ * @brief Stablo odlucivanja za komandu 'h'
+ *
+ * Tabela decision_tree je automatski generisana host programom host/tree_gen.c
+ * (make -C host decision_tree) i nalazi se u flash memoriji, kao i tabela
+ * seven_segment_display_table. Svaki cvor odgovara jednom stanju igre u kojem se
+ * igralo po predlozima stabla:
+ * - guess       -> optimalan sledeci pokusaj (Knuth minimax)
+ * - first_child -> indeks prvog deteta u tabeli
+ * - children    -> maska klasa rezultata (decision_tree_class) za koje postoji dete;
+ *                  dete za klasu k je na indeksu first_child + broj postavljenih bita
+ *                  maske ispod bita k
+ *
+ * Koren stabla je cvor 0.
+ *
+ * Stablo je generisano za podrazumevanu igru 4 x 6; za ostale vrednosti
+ * COMBINATION_LENGTH i COMBINATION_SYMBOLS tabela se ne prevodi (DECISION_TREE_AVAILABLE je 0).
+ *
+ */
+#include <stdint.h>
+
+#include "combination.h"
+
+#if COMBINATION_LENGTH == 4 && COMBINATION_SYMBOLS == 6
+#define DECISION_TREE_AVAILABLE     (1)
+#else
+#define DECISION_TREE_AVAILABLE     (0)
+#endif
+
+#define DECISION_TREE_RESULT_SLOTS  (25)    // indeks: 5 * tacni + na pogresnom mestu
+#define DECISION_TREE_CLASSES       (13)    // moguci rezultati, bez pogotka
+#define DECISION_TREE_NO_CLASS      (0xFF)
+
+typedef struct{
+    uint16_t guess;
+    uint16_t first_child;
+    uint16_t children;
+} decision_tree_node;
+
+extern const decision_tree_node decision_tree[];
+extern const unsigned int decision_tree_node_count;
+extern const unsigned char decision_tree_class[DECISION_TREE_RESULT_SLOTS];
+
+#endif /* DECISION_TREE_H_ */
@@ -0,0 +1,54 @@
+#include <stdint.h>
+
+#include "hal.h"
+#include "entropy.h"
+
+/**
+ * @brief Skup entropije
+ *
+ * - entropy_pool  - reci u koje se umesavaju uzorci, redom
+ * - entropy_index - indeks sledece reci za umesavanje
+ * - entropy_adc   - akumulator najnizih bitova AD konverzije, puni ga ADC12ISR (ISR.asm)
+ *
+ */
+static volatile uint16_t entropy_pool[ENTROPY_POOL_SIZE];
+static volatile uint8_t entropy_index = 0;
+volatile unsigned int entropy_adc = 0;
+
+/**
+ * @brief Funkcija rotate_left
+ *
+ * - opis:
+ *      Rotira 16-bitnu vrednost ulevo za dati broj mesta.
+ *
+ */
+static uint16_t rotate_left(uint16_t value, unsigned int shift){
+    return (uint16_t)((value << shift) | (value >> (16 - shift)));
+}
+
+void entropy_add(unsigned int sample){
+    uint8_t index = entropy_index;
+
+    entropy_pool[index] = rotate_left(entropy_pool[index], 5) ^ (uint16_t)sample;
+    entropy_index = (index + 1) & (ENTROPY_POOL_SIZE - 1);
+}
+
+unsigned int entropy_take(void){
+    unsigned int i;
+    unsigned short irq_state;
+    uint16_t value;
+
+    HAL_IRQ_SAVE(irq_state);
+
+    value = (uint16_t)(entropy_adc ^ HAL_TIMER_READ());
+    for(i = 0; i < ENTROPY_POOL_SIZE; i++){
+        value = rotate_left(value, 3) ^ entropy_pool[i];
+    }
+
+    // isti sadrzaj skupa ne sme dati istu vrednost i pri sledecem citanju
+    entropy_pool[entropy_index] ^= rotate_left(value, 7);
+
+    HAL_IRQ_RESTORE(irq_state);
+
+    return value;
+}
@@ -0,0 +1,48 @@
+#ifndef ENTROPY_H_
+#define ENTROPY_H_
+/**
+ * @brief Skup entropije
+ *
+ * Mali skup (ENTROPY_POOL_SIZE reci) u koji prekidne rutine u pozadini umesavaju
+ * vrednosti koje nije moguce predvideti:
+ * - najnize bitove ADC12MEM0 (sum potenciometra) - ADC12ISR u ISR.asm, preko entropy_adc
+ * - stanje brojaca tajmera TA0 u trenutku ivice na tasterima S2 i S3
+ * - stanje brojaca tajmera TA0 u trenutku prijema bajta preko UART-a
+ *
+ * Citanje (entropy_take) nikada ne blokira: uvek vraca trenutno stanje skupa.
+ *
+ */
+#define ENTROPY_POOL_SIZE       (4)     // mora biti stepen broja 2
+
+extern volatile unsigned int entropy_adc;
+/**
+ * @brief Funkcija entropy_add
+ *
+ * - opis:
+ *      Funkcija umesava uzorak u skup entropije. Poziva se iz prekidnih rutina.
+ *
+ * - argumenti:
+ *      - sample - uzorak (npr. stanje brojaca tajmera)
+ *
+ * - povratna vrednost:
+ *      nema
+ *
+ */
+extern void entropy_add(unsigned int sample);
+/**
+ * @brief Funkcija entropy_take
+ *
+ * - opis:
+ *      Funkcija sabija ceo skup entropije i ADC uzorke u jednu 16-bitnu vrednost.
+ *      Ne blokira i moze se pozvati u bilo kom trenutku.
+ *
+ * - argumenti:
+ *      nema
+ *
+ * - povratna vrednost:
+ *      Vrednost za umesavanje u generator pseudoslucajnih brojeva.
+ *
+ */
+extern unsigned int entropy_take(void);
+
+#endif /* ENTROPY_H_ */
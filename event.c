@@ -0,0 +1,36 @@
+#include "event.h"
+
+unsigned int event_put(event_queue *queue, unsigned int type, unsigned int data, unsigned long time){
+    uint8_t head = queue->head;
+    uint8_t next = (head + 1) & EVENT_QUEUE_MASK;
+    volatile event_t *slot;
+
+    if(next == queue->tail){
+        queue->lost++;
+        return 0;
+    }
+
+    slot = &queue->slots[head];
+    slot->type = (uint8_t)type;
+    slot->data = (uint8_t)data;
+    slot->time = (uint16_t)time;
+    // dogadjaj postaje vidljiv glavnom programu tek kada je ceo upisan
+    queue->head = next;
+    return 1;
+}
+
+unsigned int event_get(event_queue *queue, event_t *event){
+    uint8_t tail = queue->tail;
+
+    if(tail == queue->head){
+        return 0;
+    }
+
+    *event = queue->slots[tail];
+    queue->tail = (tail + 1) & EVENT_QUEUE_MASK;
+    return 1;
+}
+
+unsigned int event_pending(const event_queue *queue){
+    return (queue->head - queue->tail) & EVENT_QUEUE_MASK;
+}
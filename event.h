@@ -0,0 +1,102 @@
+#ifndef EVENT_H_
+#define EVENT_H_
+
+#include <stdint.h>
+/**
+ * @brief Red dogadjaja izmedju prekidne rutine i glavnog programa
+ *
+ * Svaka prekidna rutina koja prijavljuje dogadjaje ima svoj red, u koji samo ona upisuje
+ * (event_put), a iz kojeg samo glavni program cita (event_get). Zato nije potrebna
+ * zabrana prekida: svaka strana menja samo svoj indeks, a indeks se menja tek posle
+ * upisa, odnosno citanja dogadjaja. Stanje masine stanja menja samo glavni program.
+ * Bajtovi primljeni preko UART-a imaju svoj red istog tipa (uart_rx.c).
+ *
+ * Velicina reda mora biti stepen broja 2, jer se indeksi "premotavaju" maskom.
+ * Ukoliko je red pun, dogadjaj se odbacuje i broji (lost), pa se nijedan dogadjaj
+ * ne gubi neprimetno niti se obradjuje dva puta.
+ *
+ */
+#define EVENT_QUEUE_SIZE        (8)
+#define EVENT_QUEUE_MASK        (EVENT_QUEUE_SIZE - 1)
+
+#define EVENT_BUTTON_S2         (1)     // data: simbol izabran potenciometrom u trenutku pritiska
+#define EVENT_BUTTON_S3         (2)
+/**
+ * @brief Dogadjaj
+ *
+ * - type -> vrsta dogadjaja (EVENT_*)
+ * - data -> podatak uz dogadjaj
+ * - time -> nizih 16 bita vremenske oznake (timestamp.h) trenutka kada je dogadjaj upisan,
+ *           za merenje kasnjenja do obrade (do 2 s)
+ *
+ */
+typedef struct{
+    uint8_t type;
+    uint8_t data;
+    uint16_t time;
+} event_t;
+/**
+ * @brief Red dogadjaja
+ *
+ * - slots -> upisani dogadjaji; volatile kao i indeksi, kako kompajler ne bi pomerio upis
+ *            dogadjaja iza upisa head (event_put), niti citanje dogadjaja ispred citanja head
+ *            (event_get)
+ * - head  -> indeks sledeceg slobodnog mesta, menja ga samo prekidna rutina
+ * - tail  -> indeks sledeceg dogadjaja za obradu, menja ga samo glavni program
+ * - lost  -> broj odbacenih dogadjaja, menja ga samo prekidna rutina
+ *
+ */
+typedef struct{
+    volatile event_t slots[EVENT_QUEUE_SIZE];
+    volatile uint8_t head;
+    volatile uint8_t tail;
+    volatile unsigned int lost;
+} event_queue;
+/**
+ * @brief Funkcija event_put
+ *
+ * - opis:
+ *      Funkcija upisuje dogadjaj u red. Poziva je samo prekidna rutina vlasnik reda.
+ *
+ * - argumenti:
+ *      - queue - red
+ *      - type - vrsta dogadjaja
+ *      - data - podatak uz dogadjaj
+ *      - time - vremenska oznaka trenutka dogadjaja
+ *
+ * - povratna vrednost:
+ *      1 ako je dogadjaj upisan, 0 ako je red pun i dogadjaj je odbacen.
+ *
+ */
+extern unsigned int event_put(event_queue *queue, unsigned int type, unsigned int data, unsigned long time);
+/**
+ * @brief Funkcija event_get
+ *
+ * - opis:
+ *      Funkcija skida najstariji dogadjaj iz reda. Poziva je samo glavni program.
+ *
+ * - argumenti:
+ *      - queue - red
+ *      - event - pokazivac na mesto za dogadjaj
+ *
+ * - povratna vrednost:
+ *      1 ako je dogadjaj procitan, 0 ako je red prazan.
+ *
+ */
+extern unsigned int event_get(event_queue *queue, event_t *event);
+/**
+ * @brief Funkcija event_pending
+ *
+ * - opis:
+ *      Funkcija vraca broj dogadjaja koji cekaju na obradu.
+ *
+ * - argumenti:
+ *      - queue - red
+ *
+ * - povratna vrednost:
+ *      Broj dogadjaja u redu.
+ *
+ */
+extern unsigned int event_pending(const event_queue *queue);
+
+#endif /* EVENT_H_ */
@@ -0,0 +1,108 @@
+#include "combination.h"
+#include "frame.h"
+#include "uart_tx.h"
+
+/**
+ * @brief Okvir koji se prima
+ *
+ * - frame_bytes         - bajtovi pokusaja redom kako su primljeni
+ * - frame_received      - broj primljenih bajtova od FRAME_SYNC (0 kada okvir nije u toku)
+ * - frame_count         - broj pokusaja iz zaglavlja; okvir sa vise od FRAME_GUESSES_MAX
+ *                         pokusaja se ne smesta, ali se njegovi bajtovi preskacu do kraja
+ * - frame_check         - XOR svih primljenih bajtova od n
+ *
+ */
+static unsigned char frame_bytes[FRAME_GUESSES_MAX * FRAME_GUESS_BYTES];
+static unsigned int frame_received = 0;
+static unsigned int frame_count = 0;
+static unsigned char frame_check = 0;
+
+unsigned int frame_active(void){
+    return frame_received != 0;
+}
+
+unsigned int frame_feed(unsigned char byte){
+    unsigned int payload;
+
+    if(frame_received == 0){
+        if(byte == FRAME_SYNC){
+            frame_received = 1;
+            frame_check = 0;
+        }
+        return FRAME_NONE;
+    }
+
+    if(frame_received == 1){
+        frame_count = byte;
+    }
+
+    payload = frame_count * FRAME_GUESS_BYTES;
+    if(frame_received == 1 + 1 + payload){
+        // poslednji bajt je kontrolni
+        frame_received = 0;
+        if(byte != frame_check || frame_count > FRAME_GUESSES_MAX){
+            return FRAME_ERROR;
+        }
+        return frame_count == 0 ? FRAME_NEW_GAME : FRAME_GUESSES;
+    }
+
+    // pokusaji prevelikog okvira se ne mogu smestiti, ali se ipak primaju do kontrolnog
+    // bajta, kako ne bi stigli do parsera komandi kao tekst
+    if(frame_received > 1 && frame_count <= FRAME_GUESSES_MAX){
+        frame_bytes[frame_received - 2] = byte;
+    }
+    frame_check ^= byte;
+    frame_received++;
+    return FRAME_NONE;
+}
+
+unsigned int frame_guess_count(void){
+    return frame_count;
+}
+
+combination_t frame_guess(unsigned int index){
+    const unsigned char *bytes = &frame_bytes[index * FRAME_GUESS_BYTES];
+    combination_t guess = 0;
+    combination_t rest;
+    unsigned int i;
+
+    for(i = 0; i < FRAME_GUESS_BYTES; i++){
+        guess = (guess << 8) | bytes[i];
+    }
+
+    // svako od COMBINATION_LENGTH polja mora biti simbol, a polja iznad njih prazna
+    rest = guess;
+    for(i = 0; i < COMBINATION_LENGTH; i++){
+        unsigned int symbol = (unsigned int)(rest & COMBINATION_SYMBOL_MASK);
+
+        if(symbol < 1 || symbol > COMBINATION_SYMBOLS){
+            return COMBINATION_INVALID;
+        }
+        rest >>= COMBINATION_SYMBOL_BITS;
+    }
+    if(rest != 0){
+        return COMBINATION_INVALID;
+    }
+    return guess;
+}
+
+unsigned int frame_reply_write(const unsigned char *scores, unsigned int count){
+    char reply[1 + 1 + FRAME_GUESSES_MAX + 1];
+    unsigned int length = 0;
+    unsigned char check;
+    unsigned int i;
+
+    reply[length++] = (char)FRAME_SYNC;
+    reply[length++] = (char)count;
+    check = (unsigned char)count;
+    if(count == FRAME_COUNT_ERROR){
+        count = 0;
+    }
+    for(i = 0; i < count; i++){
+        reply[length++] = (char)scores[i];
+        check ^= scores[i];
+    }
+    reply[length++] = (char)check;
+
+    return uart_tx_write(reply, length);
+}
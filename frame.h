@@ -0,0 +1,119 @@
+#ifndef FRAME_H_
+#define FRAME_H_
+
+#include "combination.h"
+/**
+ * @brief Binarni protokol za automatsko testiranje
+ *
+ * Pored tekstualnih komandi (command.c), preko serijske veze mogu da se salju okviri sa
+ * vise pokusaja odjednom. Okvir pocinje bajtom FRAME_SYNC, koji se ne pojavljuje u tekstu,
+ * pa glavni program sve bajtove od njega do kraja okvira prosledjuje funkciji frame_feed.
+ *
+ * Zahtev:   FRAME_SYNC | n | n pokusaja po FRAME_GUESS_BYTES bajtova | kontrolni bajt
+ * Odgovor:  FRAME_SYNC | n | n bajtova rezultata | kontrolni bajt
+ *
+ * - n                 -> broj pokusaja, 1..FRAME_GUESSES_MAX; n = 0 odmah zapocinje novu igru
+ *                        (bez komande 'n' i tastera S3), a odgovor je prazan okvir
+ * - pokusaj           -> upakovana kombinacija (combination_t), bajt najvece tezine prvi;
+ *                        2 bajta do 4 simbola (0x12 0x34 za 1234), inace 4 bajta
+ * - rezultat          -> FRAME_SCORE: broj pogodaka na mestu u visih i broj pogodaka na
+ *                        pogresnom mestu u nizih 4 bita; FRAME_SCORE_NONE ako pokusaj nije
+ *                        ispravna kombinacija ili igra nije u toku (npr. vec je zavrsena)
+ * - kontrolni bajt    -> XOR bajta n i svih bajtova iza njega
+ *
+ * Okvir sa pogresnim kontrolnim bajtom ili prevelikim n se odbacuje, a odgovor je
+ * FRAME_SYNC | FRAME_COUNT_ERROR | FRAME_COUNT_ERROR. I preveliki okvir se prima do kraja
+ * (n * FRAME_GUESS_BYTES + 1 bajt posle n), pa nijedan njegov bajt ne stize do parsera
+ * komandi. Pokusaji iz okvira se broje kao obicni pokusaji igre, ali se za njih ne salju
+ * tekstualne poruke.
+ *
+ */
+#define FRAME_SYNC              (0xA5)
+#define FRAME_GUESSES_MAX       (16)
+#if COMBINATION_LENGTH <= 4
+#define FRAME_GUESS_BYTES       (2)
+#else
+#define FRAME_GUESS_BYTES       (4)
+#endif
+#define FRAME_COUNT_ERROR       (0xFF)
+#define FRAME_SCORE(result)     ((unsigned char)((result) >> 4))
+#define FRAME_SCORE_NONE        (0xFF)
+
+#define FRAME_NONE              (0)     // okvir jos nije zavrsen
+#define FRAME_GUESSES           (1)     // stigli su pokusaji (frame_guess_count, frame_guess)
+#define FRAME_NEW_GAME          (2)
+#define FRAME_ERROR             (3)
+/**
+ * @brief Funkcija frame_active
+ *
+ * - opis:
+ *      Funkcija proverava da li je prijem okvira u toku.
+ *
+ * - argumenti:
+ *      nema
+ *
+ * - povratna vrednost:
+ *      1 ako je primljen FRAME_SYNC, a okvir jos nije zavrsen, inace 0.
+ *
+ */
+extern unsigned int frame_active(void);
+/**
+ * @brief Funkcija frame_feed
+ *
+ * - opis:
+ *      Funkcija dodaje primljen bajt u okvir koji se sastavlja. Prvi bajt mora biti
+ *      FRAME_SYNC. Poziva je samo glavni program.
+ *
+ * - argumenti:
+ *      - byte - primljen bajt
+ *
+ * - povratna vrednost:
+ *      FRAME_NONE dok okvir nije zavrsen, zatim FRAME_GUESSES, FRAME_NEW_GAME ili FRAME_ERROR.
+ *
+ */
+extern unsigned int frame_feed(unsigned char byte);
+/**
+ * @brief Funkcija frame_guess_count
+ *
+ * - opis:
+ *      Funkcija vraca broj pokusaja u poslednjem primljenom okviru.
+ *
+ * - argumenti:
+ *      nema
+ *
+ * - povratna vrednost:
+ *      Broj pokusaja, 1..FRAME_GUESSES_MAX.
+ *
+ */
+extern unsigned int frame_guess_count(void);
+/**
+ * @brief Funkcija frame_guess
+ *
+ * - opis:
+ *      Funkcija vraca pokusaj iz poslednjeg primljenog okvira.
+ *
+ * - argumenti:
+ *      - index - redni broj pokusaja u okviru, od 0
+ *
+ * - povratna vrednost:
+ *      Upakovana kombinacija ili COMBINATION_INVALID ako pokusaj nije ispravna kombinacija.
+ *
+ */
+extern combination_t frame_guess(unsigned int index);
+/**
+ * @brief Funkcija frame_reply_write
+ *
+ * - opis:
+ *      Funkcija upisuje okvir sa odgovorom u bafer za slanje (ceo ili nista).
+ *
+ * - argumenti:
+ *      - scores - rezultati pokusaja (FRAME_SCORE ili FRAME_SCORE_NONE)
+ *      - count - broj rezultata, ili FRAME_COUNT_ERROR za odgovor na neispravan okvir
+ *
+ * - povratna vrednost:
+ *      1 ako je odgovor upisan u bafer za slanje, 0 ako nema mesta.
+ *
+ */
+extern unsigned int frame_reply_write(const unsigned char *scores, unsigned int count);
+
+#endif /* FRAME_H_ */
@@ -0,0 +1,73 @@
+#ifndef HAL_H_
+#define HAL_H_
+/**
+ * @brief Sloj apstrakcije hardvera (HAL)
+ *
+ * Sve funkcije iz combination.c pristupaju periferijama iskljucivo preko
+ * makroa iz ovog fajla. Na ciljnoj platformi (MSP430F5438A) makroi se
+ * direktno preslikavaju na registre, pa ne postoji nikakav dodatni trosak.
+ * Kada je definisan simbol HOST_BUILD, makroi se preslikavaju na softverski
+ * backend iz host/hal_host.c, pa se logika igre moze prevesti, testirati i
+ * meriti na obicnom Linux racunaru.
+ *
+ * Periferije:
+ * - UART  -> USCI_A0 (TX i RX bafer)
+ * - DMA   -> kanal 0 prenosi poruke u UCA0TXBUF (okidac UCA0TXIFG)
+ * - GPIO  -> P6 (segmenti LED displeja), P10 i P11 (selekcija displeja), P2 (tasteri)
+ * - ADC   -> ADC12, memorijska lokacija MEM0
+ * - TIMER -> brojac tajmera TA0 i zastavica prekida CCR0 (kraj periode)
+ * - IRQ   -> cuvanje/vracanje stanja globalnog interrupt-a (kriticne sekcije)
+ *
+ */
+#ifdef HOST_BUILD
+
+#include "host/hal_host.h"
+
+#else
+
+#include <msp430.h>
+
+#define HAL_UART_TX(byte)       (UCA0TXBUF = (byte))
+#define HAL_UART_RX()           (UCA0RXBUF)
+/**
+ * @brief DMA prenos u UART TX bafer
+ *
+ * Kanal 0 je podesen u main-u (DMA0TSEL = 17, UCA0TXIFG, jedan bajt po okidacu). Okidac
+ * UCA0TXIFG radi samo na ivicu (DMALEVEL vazi samo za spoljni okidac DMAE0), pa postavljen
+ * UCA0TXIFG sam po sebi ne pokrece prenos:
+ * - ako je TX bafer prazan (UCA0TXIFG = 1), posle ukljucivanja kanala ivica se pravi rucno,
+ *   brisanjem i ponovnim postavljanjem UCA0TXIFG
+ * - ako TX bafer jos nije prazan (UCA0TXIFG = 0, npr. odmah posle prethodnog prenosa),
+ *   ivica stize sama kada se bafer isprazni, pa se TX bafer nikada ne pregazi
+ * Upis reci u DMA0SA brise bitove 19-16 adrese, sto odgovara malom modelu memorije.
+ *
+ */
+#define HAL_UART_TX_DMA(source, length) \
+    do { \
+        DMA0SAL = (unsigned int)(source); \
+        DMA0SZ = (length); \
+        DMA0CTL |= DMAEN; \
+        if(UCA0IFG & UCTXIFG){ \
+            UCA0IFG &= ~UCTXIFG; \
+            UCA0IFG |= UCTXIFG; \
+        } \
+    } while(0)
+
+#define HAL_P2_IN()             (P2IN)
+#define HAL_P6_WRITE(value)     (P6OUT = (value))
+#define HAL_P10_SET(mask)       (P10OUT |= (mask))
+#define HAL_P10_CLEAR(mask)     (P10OUT &= ~(mask))
+#define HAL_P11_SET(mask)       (P11OUT |= (mask))
+#define HAL_P11_CLEAR(mask)     (P11OUT &= ~(mask))
+
+#define HAL_ADC_READ()          (ADC12MEM0)
+
+#define HAL_TIMER_READ()        (TA0R)
+#define HAL_TIMER_PERIOD_PENDING() (TA0CCTL0 & CCIFG)
+
+#define HAL_IRQ_SAVE(state)     do { (state) = __get_interrupt_state(); __disable_interrupt(); } while(0)
+#define HAL_IRQ_RESTORE(state)  __set_interrupt_state(state)
+
+#endif /* HOST_BUILD */
+
+#endif /* HAL_H_ */
@@ -0,0 +1,75 @@
+#ifdef HOST_BUILD
+/**
+ * @brief Host program check_bench
+ *
+ * Meri vreme izvrsavanja combination_check i combination_check_reference nad svim
+ * parovima kombinacija (1296 x 1296 za igru 4 x 6) i proverava da obe funkcije daju isti rezultat.
+ *
+ */
+#include <stdio.h>
+
+#include "combination.h"
+#include "host_util.h"
+
+#define CODE_COUNT      (COMBINATION_CODE_COUNT)
+#define REPEAT_COUNT    (5)
+
+typedef unsigned int (*check_kernel)(combination_t, combination_t);
+
+static combination_t codes[CODE_COUNT];
+
+// vraca najbolje vreme po pozivu u ns; checksum sprecava da kompajler izbaci pozive
+static double kernel_time(check_kernel kernel, unsigned long *checksum){
+    unsigned long i, j;
+    unsigned int r;
+    double best = 1e30;
+
+    for(r = 0; r < REPEAT_COUNT; r++){
+        unsigned long sum = 0;
+        double start = time_now_ns();
+
+        for(i = 0; i < CODE_COUNT; i++)
+            for(j = 0; j < CODE_COUNT; j++)
+                sum += kernel(codes[i], codes[j]);
+
+        double elapsed = (time_now_ns() - start) / ((double)CODE_COUNT * CODE_COUNT);
+        if(elapsed < best){
+            best = elapsed;
+        }
+        *checksum = sum;
+    }
+    return best;
+}
+
+int main(void)
+{
+    unsigned long reference_sum, swar_sum;
+    double reference_ns, swar_ns;
+    unsigned long i, j;
+
+    codes_init(codes);
+
+    for(i = 0; i < CODE_COUNT; i++){
+        for(j = 0; j < CODE_COUNT; j++){
+            unsigned int expected = combination_check_reference(codes[i], codes[j]);
+            unsigned int actual = combination_check(codes[i], codes[j]);
+
+            if(expected != actual){
+                printf("MISMATCH guess=%0*lx secret=%0*lx reference=%03x swar=%03x\n",
+                       COMBINATION_LENGTH, (unsigned long)codes[i], COMBINATION_LENGTH, (unsigned long)codes[j],
+                       expected, actual);
+                return 1;
+            }
+        }
+    }
+
+    reference_ns = kernel_time(combination_check_reference, &reference_sum);
+    swar_ns = kernel_time(combination_check, &swar_sum);
+
+    printf("combination_check_reference: %6.2f ns/op (checksum %lu)\n", reference_ns, reference_sum);
+    printf("combination_check (SWAR):    %6.2f ns/op (checksum %lu)\n", swar_ns, swar_sum);
+
+    return 0;
+}
+
+#endif /* HOST_BUILD */
@@ -0,0 +1,167 @@
+#ifdef HOST_BUILD
+/**
+ * @brief Host program check_io
+ *
+ * Provere logike koja radi izmedju prekidnih rutina i glavnog programa, nad softverskim
+ * periferijama iz hal_host.c:
+ * - vremenske oznake (TIMESTAMP_COMPOSE) ne idu unazad ni u jednom stanju tajmera TA0,
+ *   ukljucujuci TA0R == CCR0 posle CCR0ISR i prekid koji ceka (npr. u drugoj prekidnoj rutini)
+ * - bajtovi binarnog okvira (i prevelikog, koji se odbacuje) ne stizu do parsera komandi;
+ *   bajtovi se rasporedjuju izmedju frame_feed i command_feed isto kao u commands_process (main.c)
+ *
+ * Za svaku neispravnu proveru ispisuje se opis, a program vraca 1.
+ *
+ */
+#include <stdio.h>
+
+#include "timestamp.h"
+#include "frame.h"
+#include "command.h"
+#include "hal.h"
+
+#define TIMER_CHECK_PERIODS     (4)
+#define ISR_DELAY_MAX           (HAL_HOST_TA0CCR0)  // najduze kasnjenje prekida, u ACLK periodama
+
+static unsigned int failures = 0;
+
+static void check(unsigned int condition, const char *description){
+    if(!condition){
+        printf("FAIL %s\n", description);
+        failures++;
+    }
+}
+
+static unsigned long timestamp_read(void){
+    return TIMESTAMP_COMPOSE(timer_ticks, HAL_TIMER_PERIOD_PENDING(), HAL_TIMER_READ());
+}
+
+// CCR0ISR iz ISR.asm
+static void ccr0_isr(void){
+    timer_ticks++;
+    hal_host_ta0ccifg = 0;
+}
+
+static void check_timestamp(void){
+    unsigned int delay;
+
+    for(delay = 0; delay <= ISR_DELAY_MAX; delay++){
+        unsigned long first, previous;
+        unsigned int step;
+        unsigned int waiting = 0;
+        unsigned int monotonic = 1;
+        unsigned int at_ccr0 = 1;
+
+        hal_host_reset();
+        timer_ticks = 0;
+        first = previous = timestamp_read();
+
+        for(step = 0; step < TIMER_CHECK_PERIODS * TIMESTAMP_PERIOD; step++){
+            unsigned long now;
+
+            hal_host_timer_step();
+            if(hal_host_ta0ccifg && waiting++ == delay){
+                unsigned long before = timestamp_read();
+
+                ccr0_isr();
+                waiting = 0;
+                // prekid ne menja oznaku, pa citanje odmah posle njega (za delay = 0 je
+                // TA0R == CCR0) nije vece od sledeceg citanja
+                if(timestamp_read() != before){
+                    at_ccr0 = 0;
+                }
+            }
+
+            now = timestamp_read();
+            if(now < previous){
+                monotonic = 0;
+            }
+            previous = now;
+        }
+
+        if(!monotonic || !at_ccr0 || previous - first != step){
+            printf("timestamp, CCR0ISR %u ACLK period(s) late:\n", delay);
+            check(monotonic, "timestamp went backwards");
+            check(at_ccr0, "timestamp changed across CCR0ISR");
+            check(previous - first == step, "timestamp does not count ACLK periods");
+        }
+    }
+    if(failures == 0){
+        printf("%-28s OK (CCR0ISR 0..%u ACLK periods late)\n", "timestamp", (unsigned int)ISR_DELAY_MAX);
+    }
+}
+
+/**
+ * @brief Funkcija serial_feed
+ *
+ * - opis:
+ *      Prosledjuje bajt okviru ili parseru komandi kao commands_process u main.c.
+ *
+ * - povratna vrednost:
+ *      Rezultat frame_feed (FRAME_*) za bajt okvira, inace FRAME_NONE; command je
+ *      rezultat command_feed ili COMMAND_NONE ako je bajt pripao okviru.
+ *
+ */
+static unsigned int serial_feed(unsigned char byte, unsigned int *command){
+    unsigned long argument;
+
+    *command = COMMAND_NONE;
+    if(frame_active() || byte == FRAME_SYNC){
+        return frame_feed(byte);
+    }
+    *command = command_feed((char)byte, &argument);
+    return FRAME_NONE;
+}
+
+static void check_frame_oversized(void){
+    unsigned int count = FRAME_GUESSES_MAX + 1;
+    unsigned int payload = count * FRAME_GUESS_BYTES;
+    unsigned char checksum = (unsigned char)count;
+    unsigned int commands = 0;
+    unsigned int errors = 0;
+    unsigned int error_at = 0;
+    unsigned int command;
+    unsigned int failed = failures;
+    unsigned int i;
+
+    serial_feed(FRAME_SYNC, &command);
+    serial_feed((unsigned char)count, &command);
+    for(i = 0; i < payload; i++){
+        // komande u tekstu: 'h', 'p', 's', LF i sve ostalo, a poslednji bajt pokusaja
+        // podesava kontrolni bajt na 'n'
+        unsigned char byte = (i == payload - 1) ? (unsigned char)(checksum ^ 'n') : (unsigned char)"hps\n"[i % 4];
+
+        checksum ^= byte;
+        if(serial_feed(byte, &command) == FRAME_ERROR){
+            errors++;
+        }
+        commands += command != COMMAND_NONE;
+    }
+    if(serial_feed(checksum, &command) == FRAME_ERROR){
+        errors++;
+        error_at = 1;
+    }
+    commands += command != COMMAND_NONE;
+
+    check(checksum == 'n', "oversized frame: checksum byte is not 'n'");
+    check(errors == 1 && error_at, "oversized frame: FRAME_ERROR not reported exactly at the checksum byte");
+    check(commands == 0, "oversized frame: frame bytes reached the command parser");
+    check(!frame_active(), "oversized frame: frame still active after the checksum byte");
+
+    // posle okvira parser ponovo prima tekst
+    serial_feed('n', &command);
+    check(command == COMMAND_NEW_GAME, "oversized frame: 'n' after the frame is not a new game");
+
+    if(failures == failed){
+        printf("%-28s OK (n = %u, checksum 'n')\n", "oversized frame", count);
+    }
+}
+
+int main(void)
+{
+    check_timestamp();
+    check_frame_oversized();
+
+    return failures != 0;
+}
+
+#endif /* HOST_BUILD */
@@ -0,0 +1,235 @@
+#ifdef HOST_BUILD
+/**
+ * @brief Host program check_kernels
+ *
+ * Diferencijalna provera svih kernela za ocenjivanje pokusaja: za svaki od CODE_COUNT x CODE_COUNT
+ * parova (1296 x 1296 za igru 4 x 6) (pokusaj, tajna kombinacija) rezultat svakog alternativnog kernela se poredi sa
+ * combination_check_reference. Posao se deli po pokusajima na sve raspolozive niti.
+ * Ako se rezultati razlikuju, ispisuje se prvo neslaganje (najmanji indeks para) sa
+ * ulazima i oba rezultata, a program vraca 1.
+ *
+ * Paketni kerneli (host/combination_batch.c) se proveravaju po paru preko klase rezultata,
+ * a combination_check_batch i preko histograma klasa za svaki pokusaj. Kernel koji
+ * procesor ne podrzava (AVX2) se preskace.
+ *
+ * Novi kernel se proverava dodavanjem u tabelu kernels[], odnosno batch_kernels[].
+ *
+ */
+#define _POSIX_C_SOURCE 200809L
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "combination.h"
+#include "combination_batch.h"
+#include "host_util.h"
+
+#define CODE_COUNT      (COMBINATION_CODE_COUNT)
+#define MAX_THREADS     (64)
+#define NO_MISMATCH     ((unsigned long)CODE_COUNT * CODE_COUNT)
+
+typedef unsigned int (*check_kernel)(combination_t, combination_t);
+
+static const struct {
+    const char *name;
+    check_kernel kernel;
+} kernels[] = {
+    {"combination_check (SWAR)", combination_check},
+};
+#define KERNEL_COUNT    (sizeof(kernels) / sizeof(kernels[0]))
+
+static const struct {
+    const char *name;
+    combination_batch_kernel kernel;
+    unsigned int (*available)(void);    // NULL - uvek dostupan
+} batch_kernels[] = {
+    {"batch classes (scalar)", combination_batch_classes_scalar, NULL},
+#if COMBINATION_BATCH_SIMD
+    {"batch classes (sse2)",   combination_batch_classes_sse2,   NULL},
+    {"batch classes (avx2)",   combination_batch_classes_avx2,   combination_batch_avx2_supported},
+#endif
+};
+#define BATCH_KERNEL_COUNT  (sizeof(batch_kernels) / sizeof(batch_kernels[0]))
+#define HISTOGRAM_SLOT      (KERNEL_COUNT + BATCH_KERNEL_COUNT)  // combination_check_batch
+#define SLOT_COUNT          (HISTOGRAM_SLOT + 1)
+
+/**
+ * @brief Posao jedne niti
+ *
+ * Nit proverava pokusaje first, first + stride, ... i pamti svoje prvo neslaganje
+ * za svaki kernel (indeks para guess * CODE_COUNT + secret). Za histogram se pamti
+ * samo pokusaj (guess * CODE_COUNT).
+ *
+ */
+struct verify_job {
+    unsigned long first;
+    unsigned long stride;
+    unsigned long mismatch[SLOT_COUNT];
+};
+
+static combination_t codes[CODE_COUNT];
+
+static unsigned int batch_available(unsigned int k){
+    return batch_kernels[k].available == NULL || batch_kernels[k].available();
+}
+
+static void *verify_thread(void *argument){
+    struct verify_job *job = argument;
+    unsigned char *classes = malloc(BATCH_KERNEL_COUNT * (size_t)CODE_COUNT);
+    unsigned int histogram[COMBINATION_BATCH_CLASSES];
+    unsigned int expected_histogram[COMBINATION_BATCH_CLASSES];
+    unsigned long i, j;
+    unsigned int k;
+
+    for(k = 0; k < SLOT_COUNT; k++){
+        job->mismatch[k] = NO_MISMATCH;
+    }
+    if(classes == NULL){
+        return job;
+    }
+
+    for(i = job->first; i < CODE_COUNT; i += job->stride){
+        for(k = 0; k < BATCH_KERNEL_COUNT; k++){
+            if(batch_available(k)){
+                batch_kernels[k].kernel(codes[i], codes, CODE_COUNT, classes + k * (size_t)CODE_COUNT);
+            }
+        }
+        for(k = 0; k < COMBINATION_BATCH_CLASSES; k++){
+            expected_histogram[k] = 0;
+        }
+
+        for(j = 0; j < CODE_COUNT; j++){
+            unsigned int expected = combination_check_reference(codes[i], codes[j]);
+
+            for(k = 0; k < KERNEL_COUNT; k++){
+                if(job->mismatch[k] == NO_MISMATCH && kernels[k].kernel(codes[i], codes[j]) != expected){
+                    job->mismatch[k] = (unsigned long)i * CODE_COUNT + j;
+                }
+            }
+            for(k = 0; k < BATCH_KERNEL_COUNT; k++){
+                if(job->mismatch[KERNEL_COUNT + k] == NO_MISMATCH && batch_available(k)
+                   && classes[k * (size_t)CODE_COUNT + j] != COMBINATION_BATCH_CLASS(expected)){
+                    job->mismatch[KERNEL_COUNT + k] = (unsigned long)i * CODE_COUNT + j;
+                }
+            }
+            expected_histogram[COMBINATION_BATCH_CLASS(expected)]++;
+        }
+
+        combination_check_batch(codes[i], codes, CODE_COUNT, histogram);
+        for(k = 0; k < COMBINATION_BATCH_CLASSES; k++){
+            if(job->mismatch[HISTOGRAM_SLOT] == NO_MISMATCH && histogram[k] != expected_histogram[k]){
+                job->mismatch[HISTOGRAM_SLOT] = (unsigned long)i * CODE_COUNT;
+            }
+        }
+    }
+
+    free(classes);
+    return NULL;
+}
+
+static unsigned long first_mismatch(const struct verify_job *jobs, unsigned int thread_count, unsigned int slot){
+    unsigned long first = NO_MISMATCH;
+    unsigned int t;
+
+    for(t = 0; t < thread_count; t++){
+        if(jobs[t].mismatch[slot] < first){
+            first = jobs[t].mismatch[slot];
+        }
+    }
+    return first;
+}
+
+int main(void)
+{
+    static struct verify_job jobs[MAX_THREADS];
+    pthread_t threads[MAX_THREADS];
+    long online = sysconf(_SC_NPROCESSORS_ONLN);
+    unsigned int thread_count = (online < 1) ? 1 : (online > MAX_THREADS) ? MAX_THREADS : (unsigned int)online;
+    unsigned int t, k;
+    unsigned int failed = 0;
+    double start;
+
+    codes_init(codes);
+    start = time_now_s();
+
+    for(t = 0; t < thread_count; t++){
+        jobs[t].first = t;
+        jobs[t].stride = thread_count;
+        if(pthread_create(&threads[t], NULL, verify_thread, &jobs[t]) != 0){
+            fprintf(stderr, "pthread_create failed\n");
+            return 2;
+        }
+    }
+    for(t = 0; t < thread_count; t++){
+        void *status;
+
+        pthread_join(threads[t], &status);
+        if(status != NULL){
+            fprintf(stderr, "out of memory\n");
+            return 2;
+        }
+    }
+
+    for(k = 0; k < KERNEL_COUNT; k++){
+        unsigned long first = first_mismatch(jobs, thread_count, k);
+
+        if(first == NO_MISMATCH){
+            printf("%-28s OK (%lu pairs)\n", kernels[k].name, NO_MISMATCH);
+        }else{
+            combination_t guess = codes[first / CODE_COUNT];
+            combination_t secret = codes[first % CODE_COUNT];
+
+            printf("%-28s MISMATCH guess=%0*lx secret=%0*lx reference=%03x kernel=%03x\n",
+                   kernels[k].name, COMBINATION_LENGTH, (unsigned long)guess, COMBINATION_LENGTH, (unsigned long)secret,
+                   combination_check_reference(guess, secret), kernels[k].kernel(guess, secret));
+            failed = 1;
+        }
+    }
+
+    for(k = 0; k < BATCH_KERNEL_COUNT; k++){
+        unsigned long first = first_mismatch(jobs, thread_count, KERNEL_COUNT + k);
+
+        if(!batch_available(k)){
+            printf("%-28s skipped (not supported by this CPU)\n", batch_kernels[k].name);
+        }else if(first == NO_MISMATCH){
+            printf("%-28s OK (%lu pairs)\n", batch_kernels[k].name, NO_MISMATCH);
+        }else{
+            combination_t guess = codes[first / CODE_COUNT];
+            combination_t secret = codes[first % CODE_COUNT];
+            unsigned char *actual = malloc(CODE_COUNT);
+
+            // ponovo ceo niz, da bi kandidat bio u istoj SIMD koloni kao pri proveri
+            if(actual == NULL){
+                fprintf(stderr, "out of memory\n");
+                return 2;
+            }
+            batch_kernels[k].kernel(guess, codes, CODE_COUNT, actual);
+            printf("%-28s MISMATCH guess=%0*lx secret=%0*lx reference class=%u kernel class=%u\n",
+                   batch_kernels[k].name, COMBINATION_LENGTH, (unsigned long)guess, COMBINATION_LENGTH, (unsigned long)secret,
+                   COMBINATION_BATCH_CLASS(combination_check_reference(guess, secret)), actual[first % CODE_COUNT]);
+            free(actual);
+            failed = 1;
+        }
+    }
+
+    {
+        unsigned long first = first_mismatch(jobs, thread_count, HISTOGRAM_SLOT);
+
+        if(first == NO_MISMATCH){
+            printf("%-28s OK (%lu histograms, %s)\n", "combination_check_batch",
+                   (unsigned long)CODE_COUNT, combination_batch_isa());
+        }else{
+            printf("%-28s MISMATCH guess=%0*lx (histogram)\n", "combination_check_batch",
+                   COMBINATION_LENGTH, (unsigned long)codes[first / CODE_COUNT]);
+            failed = 1;
+        }
+    }
+
+    printf("%u kernel(s), %u thread(s), %.3f s\n", (unsigned int)SLOT_COUNT, thread_count, time_now_s() - start);
+
+    return failed;
+}
+
+#endif /* HOST_BUILD */
@@ -0,0 +1,255 @@
+#ifdef HOST_BUILD
+#include "combination.h"
+#include "combination_batch.h"
+
+#if COMBINATION_BATCH_SIMD
+#include <immintrin.h>
+#endif
+
+#define NIBBLE_LOW_MASK     (COMBINATION_LSB_MASK * 7)     // bitovi 2..0 svakog polja
+#define NIBBLE_HIGH_MASK    (COMBINATION_LSB_MASK * 8)     // bit 3 svakog polja
+#define BATCH_BLOCK         (256)                          // klase za jedan blok se cuvaju na steku
+
+/**
+ * @brief Simboli pokusaja
+ *
+ * Broj pojavljivanja simbola s u kandidatu se racuna samo za simbole koji postoje
+ * u pokusaju (za ostale je min(pokusaj, kandidat) = 0), pa je ovo najvise
+ * COMBINATION_LENGTH razlicitih simbola sa brojem pojavljivanja u pokusaju.
+ *
+ */
+struct guess_symbols {
+    unsigned int count;
+    combination_t pattern[COMBINATION_LENGTH];      // simbol ponovljen na svim pozicijama
+    unsigned int occurrences[COMBINATION_LENGTH];
+};
+
+static void guess_symbols_init(combination_t guess, struct guess_symbols *symbols){
+    unsigned int seen = 0;
+    unsigned int position;
+
+    symbols->count = 0;
+    for(position = 0; position < COMBINATION_LENGTH; position++){
+        unsigned int symbol = COMBINATION_SYMBOL(guess, position);
+        unsigned int p, occurrences = 0;
+
+        if(seen & (1u << symbol)){
+            continue;
+        }
+        seen |= 1u << symbol;
+        for(p = 0; p < COMBINATION_LENGTH; p++){
+            occurrences += COMBINATION_SYMBOL(guess, p) == symbol;
+        }
+        symbols->pattern[symbols->count] = COMBINATION_LSB_MASK * symbol;
+        symbols->occurrences[symbols->count] = occurrences;
+        symbols->count++;
+    }
+}
+
+// broj pozicija na kojima je polje razlike x razlicito od nule
+static unsigned int nibble_nonzero_count(combination_t x){
+    combination_t flags = ((((x & NIBBLE_LOW_MASK) + NIBBLE_LOW_MASK) | x) & NIBBLE_HIGH_MASK) >> 3;
+
+    // proizvod sabira sva polja u polje COMBINATION_LENGTH - 1 (zbir je manji od 8, bez prenosa)
+    return (unsigned int)((flags * COMBINATION_LSB_MASK) >> (COMBINATION_SYMBOL_BITS * (COMBINATION_LENGTH - 1)))
+           & COMBINATION_SYMBOL_MASK;
+}
+
+static unsigned int class_scalar(combination_t guess, const struct guess_symbols *symbols, combination_t candidate){
+    unsigned int scored = COMBINATION_LENGTH - nibble_nonzero_count(candidate ^ guess);
+    unsigned int matched = 0;
+    unsigned int k;
+
+    for(k = 0; k < symbols->count; k++){
+        unsigned int occurrences = COMBINATION_LENGTH - nibble_nonzero_count(candidate ^ symbols->pattern[k]);
+
+        matched += (occurrences < symbols->occurrences[k]) ? occurrences : symbols->occurrences[k];
+    }
+    // (LENGTH + 1) * tacni + (ukupno - tacni)
+    return scored * COMBINATION_LENGTH + matched;
+}
+
+void combination_batch_classes_scalar(combination_t guess, const combination_t *candidates,
+                                      unsigned int count, unsigned char *classes){
+    struct guess_symbols symbols;
+    unsigned int i;
+
+    guess_symbols_init(guess, &symbols);
+    for(i = 0; i < count; i++){
+        classes[i] = (unsigned char)class_scalar(guess, &symbols, candidates[i]);
+    }
+}
+
+#if COMBINATION_BATCH_SIMD
+/**
+ * @brief SSE2 kernel
+ *
+ * Isti racun kao class_scalar, u 32-bitnim kolonama (combination_t je unsigned int):
+ * polja razlicita od nule se oznacavaju u bitu 3, a zbir polja se dobija pomeranjima
+ * i sabiranjem (SSE2 nema mnozenje 32-bitnih kolona). Vrednosti u kolonama su manje
+ * od 256, pa min i mnozenje rade nad 16-bitnim polovinama. Cetiri registra (16 kandidata)
+ * se pakuju u 16 bajtova klasa.
+ *
+ */
+static __m128i nibble_nonzero_count_sse2(__m128i x){
+    const __m128i low = _mm_set1_epi32(NIBBLE_LOW_MASK);
+    const __m128i high = _mm_set1_epi32(NIBBLE_HIGH_MASK);
+    __m128i flags = _mm_and_si128(_mm_or_si128(_mm_add_epi32(_mm_and_si128(x, low), low), x), high);
+
+    flags = _mm_srli_epi32(flags, 3);
+    flags = _mm_add_epi32(flags, _mm_srli_epi32(flags, 4));
+    flags = _mm_add_epi32(flags, _mm_srli_epi32(flags, 8));
+    return _mm_and_si128(flags, _mm_set1_epi32(COMBINATION_SYMBOL_MASK));
+}
+
+static __m128i class_sse2(__m128i guess, const struct guess_symbols *symbols, __m128i candidate){
+    const __m128i length = _mm_set1_epi32(COMBINATION_LENGTH);
+    __m128i scored = _mm_sub_epi32(length, nibble_nonzero_count_sse2(_mm_xor_si128(candidate, guess)));
+    __m128i matched = _mm_setzero_si128();
+    unsigned int k;
+
+    for(k = 0; k < symbols->count; k++){
+        __m128i pattern = _mm_set1_epi32((int)symbols->pattern[k]);
+        __m128i occurrences = _mm_sub_epi32(length, nibble_nonzero_count_sse2(_mm_xor_si128(candidate, pattern)));
+
+        matched = _mm_add_epi32(matched, _mm_min_epi16(occurrences, _mm_set1_epi32((int)symbols->occurrences[k])));
+    }
+    return _mm_add_epi32(_mm_mullo_epi16(scored, length), matched);
+}
+
+void combination_batch_classes_sse2(combination_t guess, const combination_t *candidates,
+                                    unsigned int count, unsigned char *classes){
+    struct guess_symbols symbols;
+    __m128i guess_vector = _mm_set1_epi32((int)guess);
+    unsigned int i = 0;
+
+    guess_symbols_init(guess, &symbols);
+    for(; i + 16 <= count; i += 16){
+        const __m128i *source = (const __m128i *)(candidates + i);
+        __m128i c0 = class_sse2(guess_vector, &symbols, _mm_loadu_si128(source + 0));
+        __m128i c1 = class_sse2(guess_vector, &symbols, _mm_loadu_si128(source + 1));
+        __m128i c2 = class_sse2(guess_vector, &symbols, _mm_loadu_si128(source + 2));
+        __m128i c3 = class_sse2(guess_vector, &symbols, _mm_loadu_si128(source + 3));
+
+        _mm_storeu_si128((__m128i *)(classes + i),
+                         _mm_packus_epi16(_mm_packs_epi32(c0, c1), _mm_packs_epi32(c2, c3)));
+    }
+    for(; i < count; i++){
+        classes[i] = (unsigned char)class_scalar(guess, &symbols, candidates[i]);
+    }
+}
+
+/**
+ * @brief AVX2 kernel
+ *
+ * Isti racun kao SSE2 kernel, 8 kandidata po registru. Pakovanje radi unutar 128-bitnih
+ * polovina, pa se 32 bajta klasa na kraju vracaju u redosled kandidata permutacijom.
+ *
+ */
+__attribute__((target("avx2")))
+static __m256i nibble_nonzero_count_avx2(__m256i x){
+    const __m256i low = _mm256_set1_epi32(NIBBLE_LOW_MASK);
+    const __m256i high = _mm256_set1_epi32(NIBBLE_HIGH_MASK);
+    __m256i flags = _mm256_and_si256(_mm256_or_si256(_mm256_add_epi32(_mm256_and_si256(x, low), low), x), high);
+
+    flags = _mm256_srli_epi32(flags, 3);
+    flags = _mm256_add_epi32(flags, _mm256_srli_epi32(flags, 4));
+    flags = _mm256_add_epi32(flags, _mm256_srli_epi32(flags, 8));
+    return _mm256_and_si256(flags, _mm256_set1_epi32(COMBINATION_SYMBOL_MASK));
+}
+
+__attribute__((target("avx2")))
+static __m256i class_avx2(__m256i guess, const struct guess_symbols *symbols, __m256i candidate){
+    const __m256i length = _mm256_set1_epi32(COMBINATION_LENGTH);
+    __m256i scored = _mm256_sub_epi32(length, nibble_nonzero_count_avx2(_mm256_xor_si256(candidate, guess)));
+    __m256i matched = _mm256_setzero_si256();
+    unsigned int k;
+
+    for(k = 0; k < symbols->count; k++){
+        __m256i pattern = _mm256_set1_epi32((int)symbols->pattern[k]);
+        __m256i occurrences = _mm256_sub_epi32(length, nibble_nonzero_count_avx2(_mm256_xor_si256(candidate, pattern)));
+
+        matched = _mm256_add_epi32(matched, _mm256_min_epu32(occurrences, _mm256_set1_epi32((int)symbols->occurrences[k])));
+    }
+    return _mm256_add_epi32(_mm256_mullo_epi16(scored, length), matched);
+}
+
+__attribute__((target("avx2")))
+void combination_batch_classes_avx2(combination_t guess, const combination_t *candidates,
+                                    unsigned int count, unsigned char *classes){
+    struct guess_symbols symbols;
+    __m256i guess_vector = _mm256_set1_epi32((int)guess);
+    const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    unsigned int i = 0;
+
+    guess_symbols_init(guess, &symbols);
+    for(; i + 32 <= count; i += 32){
+        const __m256i *source = (const __m256i *)(candidates + i);
+        __m256i c0 = class_avx2(guess_vector, &symbols, _mm256_loadu_si256(source + 0));
+        __m256i c1 = class_avx2(guess_vector, &symbols, _mm256_loadu_si256(source + 1));
+        __m256i c2 = class_avx2(guess_vector, &symbols, _mm256_loadu_si256(source + 2));
+        __m256i c3 = class_avx2(guess_vector, &symbols, _mm256_loadu_si256(source + 3));
+        __m256i packed = _mm256_packus_epi16(_mm256_packs_epi32(c0, c1), _mm256_packs_epi32(c2, c3));
+
+        _mm256_storeu_si256((__m256i *)(classes + i), _mm256_permutevar8x32_epi32(packed, order));
+    }
+    for(; i < count; i++){
+        classes[i] = (unsigned char)class_scalar(guess, &symbols, candidates[i]);
+    }
+}
+#endif /* COMBINATION_BATCH_SIMD */
+
+unsigned int combination_batch_avx2_supported(void){
+#if COMBINATION_BATCH_SIMD
+    return __builtin_cpu_supports("avx2") ? 1 : 0;
+#else
+    return 0;
+#endif
+}
+
+static combination_batch_kernel batch_kernel(void){
+#if COMBINATION_BATCH_SIMD
+    return combination_batch_avx2_supported() ? combination_batch_classes_avx2 : combination_batch_classes_sse2;
+#else
+    return combination_batch_classes_scalar;
+#endif
+}
+
+const char *combination_batch_isa(void){
+#if COMBINATION_BATCH_SIMD
+    return combination_batch_avx2_supported() ? "avx2" : "sse2";
+#else
+    return "scalar";
+#endif
+}
+
+void combination_check_batch(combination_t guess, const combination_t *candidates,
+                             unsigned int count, unsigned int *histogram){
+    combination_batch_kernel kernel = batch_kernel();
+    unsigned char classes[BATCH_BLOCK];
+    // dva histograma naizmenicno, da uzastopni kandidati iste klase ne cekaju jedan na drugi
+    unsigned int partial[2][COMBINATION_BATCH_CLASSES];
+    unsigned int i, k;
+
+    for(k = 0; k < COMBINATION_BATCH_CLASSES; k++){
+        partial[0][k] = 0;
+        partial[1][k] = 0;
+    }
+    for(i = 0; i < count; i += BATCH_BLOCK){
+        unsigned int block = (count - i < BATCH_BLOCK) ? count - i : BATCH_BLOCK;
+
+        kernel(guess, candidates + i, block, classes);
+        for(k = 0; k + 1 < block; k += 2){
+            partial[0][classes[k]]++;
+            partial[1][classes[k + 1]]++;
+        }
+        if(k < block){
+            partial[0][classes[k]]++;
+        }
+    }
+    for(k = 0; k < COMBINATION_BATCH_CLASSES; k++){
+        histogram[k] = partial[0][k] + partial[1][k];
+    }
+}
+
+#endif /* HOST_BUILD */
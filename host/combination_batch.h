@@ -0,0 +1,90 @@
+#ifndef COMBINATION_BATCH_H_
+#define COMBINATION_BATCH_H_
+/**
+ * @brief Paketno ocenjivanje jednog pokusaja (host)
+ *
+ * Osnovna operacija svakog resavaca je ocenjivanje jednog pokusaja protiv svih jos
+ * mogucih kombinacija. Ovde se to radi jednim pozivom nad celim nizom kandidata,
+ * bez poziva combination_check po paru, a rezultat je direktno histogram klasa
+ * rezultata (za minimax, ocekivanu velicinu ili entropiju).
+ *
+ * Klasa rezultata je (COMBINATION_LENGTH + 1) * tacni + na pogresnom mestu, isto kao
+ * u solver.c. Semantika je ista kao kod combination_check.
+ *
+ * Kerneli racunaju klase za blok kandidata:
+ * - scalar -> SWAR aritmetika nad combination_t, radi za svaku konfiguraciju igre
+ * - sse2   -> 4 kandidata po registru, za COMBINATION_LENGTH <= 4 na x86
+ * - avx2   -> 8 kandidata po registru, bira se u toku rada ako ga procesor podrzava
+ *
+ */
+#include "combination.h"
+
+#define COMBINATION_BATCH_CLASSES       ((COMBINATION_LENGTH + 1) * (COMBINATION_LENGTH + 1))
+#define COMBINATION_BATCH_CLASS(result) \
+        (RESULT_SCORED(result) * (COMBINATION_LENGTH + 1) + RESULT_WRONG_PLACE(result))
+
+#if COMBINATION_LENGTH <= 4 && defined(__GNUC__) && (defined(__x86_64__) || (defined(__i386__) && defined(__SSE2__)))
+#define COMBINATION_BATCH_SIMD          (1)
+#else
+#define COMBINATION_BATCH_SIMD          (0)
+#endif
+
+/**
+ * @brief Kernel za klase rezultata
+ *
+ * Upisuje klasu rezultata combination_check(guess, candidates[i]) u classes[i],
+ * za i iz [0; count).
+ *
+ */
+typedef void (*combination_batch_kernel)(combination_t guess, const combination_t *candidates,
+                                         unsigned int count, unsigned char *classes);
+
+extern void combination_batch_classes_scalar(combination_t guess, const combination_t *candidates,
+                                             unsigned int count, unsigned char *classes);
+#if COMBINATION_BATCH_SIMD
+extern void combination_batch_classes_sse2(combination_t guess, const combination_t *candidates,
+                                           unsigned int count, unsigned char *classes);
+extern void combination_batch_classes_avx2(combination_t guess, const combination_t *candidates,
+                                           unsigned int count, unsigned char *classes);
+#endif
+/**
+ * @brief Funkcija combination_batch_avx2_supported
+ *
+ * - opis:
+ *      Proverava da li procesor podrzava AVX2, tj. da li sme da se pozove
+ *      combination_batch_classes_avx2.
+ *
+ * - povratna vrednost:
+ *      1 ako je AVX2 kernel dostupan, inace 0.
+ *
+ */
+extern unsigned int combination_batch_avx2_supported(void);
+/**
+ * @brief Funkcija combination_batch_isa
+ *
+ * - povratna vrednost:
+ *      Naziv kernela koji koristi combination_check_batch ("avx2", "sse2" ili "scalar").
+ *
+ */
+extern const char *combination_batch_isa(void);
+/**
+ * @brief Funkcija combination_check_batch
+ *
+ * - opis:
+ *      Ocenjuje pokusaj guess protiv count kandidata najbrzim dostupnim kernelom
+ *      i broji rezultate po klasama.
+ *
+ * - argumenti:
+ *      - guess      - upakovan pokusaj
+ *      - candidates - niz upakovanih kombinacija
+ *      - count      - broj kombinacija u nizu
+ *      - histogram  - izlaz, COMBINATION_BATCH_CLASSES brojaca (funkcija ih prvo brise)
+ *
+ * - povratna vrednost:
+ *      nema
+ *
+ */
+extern void combination_check_batch(combination_t guess, const combination_t *candidates,
+                                    unsigned int count, unsigned int *histogram);
+
+#endif /* COMBINATION_BATCH_H_ */
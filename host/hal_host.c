@@ -0,0 +1,88 @@
+#ifdef HOST_BUILD
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <string.h>
+#include <time.h>
+
+#include "hal_host.h"
+
+// softverski "registri" periferija
+volatile uint8_t hal_host_uart_txbuf = 0;
+volatile uint8_t hal_host_uart_rxbuf = 0;
+volatile uint8_t hal_host_p2in = BIT6 | BIT5; // tasteri su aktivni na nuli
+volatile uint8_t hal_host_p6out = 0;
+volatile uint8_t hal_host_p10out = 0;
+volatile uint8_t hal_host_p11out = 0;
+volatile uint16_t hal_host_adc12mem0 = 0;
+volatile uint16_t hal_host_ta0r = 0;
+volatile uint8_t hal_host_ta0ccifg = 0;
+
+// log svih bajtova poslatih preko UART-a
+char hal_host_uart_tx_log[HAL_HOST_UART_LOG_SIZE];
+unsigned int hal_host_uart_tx_count = 0;
+
+uint8_t hal_host_uart_tx(uint8_t byte){
+    hal_host_uart_txbuf = byte;
+
+    // kada se log napuni, krece se ispocetka da benchmark-ovi ne bi pisali van niza
+    if(hal_host_uart_tx_count >= HAL_HOST_UART_LOG_SIZE - 1){
+        hal_host_uart_tx_count = 0;
+    }
+    hal_host_uart_tx_log[hal_host_uart_tx_count++] = (char)byte;
+    hal_host_uart_tx_log[hal_host_uart_tx_count] = '\0';
+
+    return byte;
+}
+
+void hal_host_uart_tx_dma(const char *source, unsigned int length){
+    unsigned int i;
+
+    for(i = 0; i < length; i++){
+        hal_host_uart_tx((uint8_t)source[i]);
+    }
+}
+
+unsigned long hal_host_timestamp(void){
+    static struct timespec start;
+    static int started = 0;
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    if(!started){
+        start = now;
+        started = 1;
+    }
+
+    return (unsigned long)((double)(now.tv_sec - start.tv_sec) * 32768.0
+                         + (double)(now.tv_nsec - start.tv_nsec) * 32768.0 / 1e9);
+}
+
+void hal_host_timer_step(void){
+    if(hal_host_ta0r >= HAL_HOST_TA0CCR0){
+        hal_host_ta0r = 0;
+    }else{
+        hal_host_ta0r++;
+    }
+    // kao na MSP430: CCIFG se postavlja kada brojac dostigne CCR0, a ne kada se vrati na 0
+    if(hal_host_ta0r == HAL_HOST_TA0CCR0){
+        hal_host_ta0ccifg = 1;
+    }
+}
+
+void hal_host_reset(void){
+    hal_host_uart_txbuf = 0;
+    hal_host_uart_rxbuf = 0;
+    hal_host_p2in = BIT6 | BIT5;
+    hal_host_p6out = 0;
+    hal_host_p10out = 0;
+    hal_host_p11out = 0;
+    hal_host_adc12mem0 = 0;
+    hal_host_ta0r = 0;
+    hal_host_ta0ccifg = 0;
+
+    memset(hal_host_uart_tx_log, 0, sizeof(hal_host_uart_tx_log));
+    hal_host_uart_tx_count = 0;
+}
+
+#endif /* HOST_BUILD */
@@ -0,0 +1,137 @@
+#ifndef HAL_HOST_H_
+#define HAL_HOST_H_
+/**
+ * @brief Softverski backend HAL-a za Linux (HOST_BUILD)
+ *
+ * Registri periferija su zamenjeni obicnim promenljivama. Svaki bajt upisan u
+ * UART TX bafer se cuva u hal_host_uart_tx_log, pa testovi i benchmark-ovi mogu
+ * da uporede poslatu poruku sa ocekivanom. Vrednosti za RX bafer, P2IN,
+ * ADC12MEM0 i brojac tajmera se postavljaju direktno iz host programa.
+ *
+ */
+#include <stdint.h>
+
+#ifndef BIT0
+#define BIT0                    (0x0001)
+#define BIT1                    (0x0002)
+#define BIT2                    (0x0004)
+#define BIT3                    (0x0008)
+#define BIT4                    (0x0010)
+#define BIT5                    (0x0020)
+#define BIT6                    (0x0040)
+#define BIT7                    (0x0080)
+#endif
+
+#define HAL_HOST_UART_LOG_SIZE  (4096)
+#define HAL_HOST_TA0CCR0        (63)        // TIMER_PERIOD iz main.c
+
+extern volatile uint8_t hal_host_uart_txbuf;
+extern volatile uint8_t hal_host_uart_rxbuf;
+extern volatile uint8_t hal_host_p2in;
+extern volatile uint8_t hal_host_p6out;
+extern volatile uint8_t hal_host_p10out;
+extern volatile uint8_t hal_host_p11out;
+extern volatile uint16_t hal_host_adc12mem0;
+extern volatile uint16_t hal_host_ta0r;
+extern volatile uint8_t hal_host_ta0ccifg;
+
+extern char hal_host_uart_tx_log[HAL_HOST_UART_LOG_SIZE];
+extern unsigned int hal_host_uart_tx_count;
+
+/**
+ * @brief Funkcija hal_host_uart_tx
+ *
+ * - opis:
+ *      Upisuje bajt u softverski TX bafer i dodaje ga u log poslatih bajtova.
+ *
+ * - argumenti:
+ *      - byte - bajt koji se salje
+ *
+ * - povratna vrednost:
+ *      Poslati bajt.
+ *
+ */
+extern uint8_t hal_host_uart_tx(uint8_t byte);
+/**
+ * @brief Funkcija hal_host_uart_tx_dma
+ *
+ * - opis:
+ *      Simulira DMA prenos: odmah salje sve bajtove preko hal_host_uart_tx. Prekid na kraju
+ *      prenosa se simulira tako sto host program pozove uart_tx_isr().
+ *
+ * - argumenti:
+ *      - source - pokazivac na prvi bajt
+ *      - length - broj bajtova
+ *
+ * - povratna vrednost:
+ *      nema
+ *
+ */
+extern void hal_host_uart_tx_dma(const char *source, unsigned int length);
+/**
+ * @brief Funkcija hal_host_timestamp
+ *
+ * - opis:
+ *      Vraca proteklo vreme od prvog poziva, izrazeno u ACLK periodama (32768 Hz),
+ *      kako bi host merenja imala iste jedinice kao timestamp_now() na mikrokontroleru.
+ *
+ * - argumenti:
+ *      nema
+ *
+ * - povratna vrednost:
+ *      Vremenska oznaka u ACLK periodama.
+ *
+ */
+extern unsigned long hal_host_timestamp(void);
+/**
+ * @brief Funkcija hal_host_timer_step
+ *
+ * - opis:
+ *      Pomera softverski tajmer TA0 (up mod do HAL_HOST_TA0CCR0) za jednu ACLK periodu i
+ *      postavlja hal_host_ta0ccifg kada brojac dostigne HAL_HOST_TA0CCR0. Prekidnu rutinu
+ *      CCR0ISR simulira host program (timer_ticks++, brisanje zastavice).
+ *
+ * - argumenti:
+ *      nema
+ *
+ * - povratna vrednost:
+ *      nema
+ *
+ */
+extern void hal_host_timer_step(void);
+/**
+ * @brief Funkcija hal_host_reset
+ *
+ * - opis:
+ *      Vraca sve softverske registre i log poslatih bajtova na pocetne vrednosti.
+ *
+ * - argumenti:
+ *      nema
+ *
+ * - povratna vrednost:
+ *      nema
+ *
+ */
+extern void hal_host_reset(void);
+
+#define HAL_UART_TX(byte)       hal_host_uart_tx((uint8_t)(byte))
+#define HAL_UART_RX()           (hal_host_uart_rxbuf)
+#define HAL_UART_TX_DMA(source, length) hal_host_uart_tx_dma((source), (length))
+
+#define HAL_P2_IN()             (hal_host_p2in)
+#define HAL_P6_WRITE(value)     (hal_host_p6out = (uint8_t)(value))
+#define HAL_P10_SET(mask)       (hal_host_p10out |= (uint8_t)(mask))
+#define HAL_P10_CLEAR(mask)     (hal_host_p10out &= (uint8_t)~(mask))
+#define HAL_P11_SET(mask)       (hal_host_p11out |= (uint8_t)(mask))
+#define HAL_P11_CLEAR(mask)     (hal_host_p11out &= (uint8_t)~(mask))
+
+#define HAL_ADC_READ()          (hal_host_adc12mem0)
+
+#define HAL_TIMER_READ()        (hal_host_ta0r)
+#define HAL_TIMER_PERIOD_PENDING() (hal_host_ta0ccifg)
+
+// na host-u nema prekida, pa su kriticne sekcije prazne
+#define HAL_IRQ_SAVE(state)     ((state) = 0)
+#define HAL_IRQ_RESTORE(state)  ((void)(state))
+
+#endif /* HAL_HOST_H_ */
@@ -0,0 +1,33 @@
+#ifdef HOST_BUILD
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <time.h>
+
+#include "host_util.h"
+
+void codes_init(combination_t *codes){
+    combination_t combination = COMBINATION_LSB_MASK;
+    unsigned long n;
+
+    for(n = 0; n < COMBINATION_CODE_COUNT; n++){
+        codes[n] = combination;
+        combination = combination_next(combination);
+    }
+}
+
+double time_now_s(void){
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + (double)now.tv_nsec * 1e-9;
+}
+
+double time_now_ns(void){
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec * 1e9 + (double)now.tv_nsec;
+}
+
+#endif /* HOST_BUILD */
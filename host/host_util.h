@@ -0,0 +1,54 @@
+#ifndef HOST_UTIL_H_
+#define HOST_UTIL_H_
+/**
+ * @brief Pomocne funkcije host programa
+ *
+ * Merenje vremena i tabela svih kombinacija, zajednicki za check_bench, check_kernels,
+ * kernel_bench, tournament i tree_gen.
+ *
+ */
+#include "combination.h"
+/**
+ * @brief Funkcija codes_init
+ *
+ * - opis:
+ *      Upisuje sve kombinacije igre u rastucem redosledu (combination_next, od 11..1).
+ *
+ * - argumenti:
+ *      - codes - niz od COMBINATION_CODE_COUNT kombinacija
+ *
+ * - povratna vrednost:
+ *      nema
+ *
+ */
+extern void codes_init(combination_t *codes);
+/**
+ * @brief Funkcija time_now_s
+ *
+ * - opis:
+ *      Vraca vreme monotonog sata (CLOCK_MONOTONIC) u sekundama.
+ *
+ * - argumenti:
+ *      nema
+ *
+ * - povratna vrednost:
+ *      Vreme u sekundama.
+ *
+ */
+extern double time_now_s(void);
+/**
+ * @brief Funkcija time_now_ns
+ *
+ * - opis:
+ *      Vraca vreme monotonog sata (CLOCK_MONOTONIC) u nanosekundama.
+ *
+ * - argumenti:
+ *      nema
+ *
+ * - povratna vrednost:
+ *      Vreme u nanosekundama.
+ *
+ */
+extern double time_now_ns(void);
+
+#endif /* HOST_UTIL_H_ */
@@ -0,0 +1,259 @@
+#ifdef HOST_BUILD
+/**
+ * @brief Host program kernel_bench
+ *
+ * Meri propusnost (ops/sec) i prosecno trajanje jedne operacije (ns/op) za funkcije
+ * logike igre, kao polaznu tacku za poredjenje buducih optimizacija:
+ * - combination_check i combination_check_reference nad svim parovima (1296 x 1296 za igru 4 x 6)
+ * - paketni kerneli (host/combination_batch.c) nad istim parovima, jedan poziv po pokusaju;
+ *   combination_check_batch koristi najbrzi kernel koji procesor podrzava
+ * - symbol_push nad svim pozicijama i simbolima
+ * - ADC_symbol_map nad svim 12-bitnim rezultatima i svim prethodnim simbolima
+ * - combination_generate (sa ponovnim sejanjem iz skupa entropije, kao na mikrokontroleru)
+ * - new_game_print, step_results_print i final_results_print, po celoj poruci: upis
+ *   u bafer za slanje i slanje svih bajtova kroz DMA prenose (uart_tx_isr())
+ *
+ * Za svaki kernel se uzima najbolje od REPEAT_COUNT ponavljanja.
+ *
+ */
+#include <stdio.h>
+
+#include "combination.h"
+#include "combination_batch.h"
+#include "uart_tx.h"
+#include "entropy.h"
+#include "hal_host.h"
+#include "host_util.h"
+
+#define CODE_COUNT          (COMBINATION_CODE_COUNT)
+#define REPEAT_COUNT        (5)
+#define SYMBOL_PUSH_ROUNDS  (100000)
+#define ADC_MAP_ROUNDS      (100)
+#define GENERATE_COUNT      (200000)
+#define MESSAGE_COUNT       (20000)
+
+/**
+ * @brief Telo benchmark-a
+ *
+ * Izvrsava sve operacije jednog kernela, upisuje njihov broj u ops i vraca checksum
+ * koji sprecava da kompajler izbaci pozive.
+ *
+ */
+typedef unsigned long (*bench_body)(unsigned long *ops);
+
+static combination_t codes[CODE_COUNT];
+static unsigned char batch_classes[CODE_COUNT];
+
+// slanje svih bajtova iz bafera, kao niz DMA prenosa na mikrokontroleru
+static void uart_tx_drain(void){
+    while(uart_tx_pending() > 0){
+        uart_tx_isr();
+    }
+    uart_tx_isr();
+}
+
+static unsigned long bench_check_swar(unsigned long *ops){
+    unsigned long sum = 0;
+    unsigned long i, j;
+
+    for(i = 0; i < CODE_COUNT; i++)
+        for(j = 0; j < CODE_COUNT; j++)
+            sum += combination_check(codes[i], codes[j]);
+
+    *ops = (unsigned long)CODE_COUNT * CODE_COUNT;
+    return sum;
+}
+
+static unsigned long bench_check_reference(unsigned long *ops){
+    unsigned long sum = 0;
+    unsigned long i, j;
+
+    for(i = 0; i < CODE_COUNT; i++)
+        for(j = 0; j < CODE_COUNT; j++)
+            sum += combination_check_reference(codes[i], codes[j]);
+
+    *ops = (unsigned long)CODE_COUNT * CODE_COUNT;
+    return sum;
+}
+
+static unsigned long bench_batch_kernel(combination_batch_kernel kernel, unsigned long *ops){
+    unsigned long sum = 0;
+    unsigned long i;
+
+    for(i = 0; i < CODE_COUNT; i++){
+        kernel(codes[i], codes, CODE_COUNT, batch_classes);
+        sum += batch_classes[i] + batch_classes[CODE_COUNT - 1 - i];
+    }
+
+    *ops = (unsigned long)CODE_COUNT * CODE_COUNT;
+    return sum;
+}
+
+static unsigned long bench_batch_scalar(unsigned long *ops){
+    return bench_batch_kernel(combination_batch_classes_scalar, ops);
+}
+
+#if COMBINATION_BATCH_SIMD
+static unsigned long bench_batch_sse2(unsigned long *ops){
+    return bench_batch_kernel(combination_batch_classes_sse2, ops);
+}
+
+static unsigned long bench_batch_avx2(unsigned long *ops){
+    return bench_batch_kernel(combination_batch_classes_avx2, ops);
+}
+#endif
+
+static unsigned long bench_check_batch(unsigned long *ops){
+    unsigned int histogram[COMBINATION_BATCH_CLASSES];
+    unsigned long sum = 0;
+    unsigned long i;
+
+    for(i = 0; i < CODE_COUNT; i++){
+        combination_check_batch(codes[i], codes, CODE_COUNT, histogram);
+        sum += histogram[i % COMBINATION_BATCH_CLASSES];
+    }
+
+    *ops = (unsigned long)CODE_COUNT * CODE_COUNT;
+    return sum;
+}
+
+static unsigned long bench_symbol_push(unsigned long *ops){
+    unsigned long sum = 0;
+    unsigned int r, index, symbol;
+
+    for(r = 0; r < SYMBOL_PUSH_ROUNDS; r++)
+        for(index = 1; index <= COMBINATION_LENGTH; index++)
+            for(symbol = 1; symbol <= COMBINATION_SYMBOLS; symbol++)
+                sum += symbol_push(index, symbol ^ (r & 1));
+
+    *ops = (unsigned long)SYMBOL_PUSH_ROUNDS * COMBINATION_LENGTH * COMBINATION_SYMBOLS;
+    return sum;
+}
+
+static unsigned long bench_adc_symbol_map(unsigned long *ops){
+    unsigned long sum = 0;
+    unsigned int r, ad_average, symbol;
+
+    for(r = 0; r < ADC_MAP_ROUNDS; r++)
+        for(symbol = 0; symbol <= COMBINATION_SYMBOLS; symbol++)
+            for(ad_average = 0; ad_average < 4096; ad_average++)
+                sum += ADC_symbol_map(ad_average, symbol);
+
+    *ops = (unsigned long)ADC_MAP_ROUNDS * (COMBINATION_SYMBOLS + 1) * 4096;
+    return sum;
+}
+
+static unsigned long bench_generate(unsigned long *ops){
+    unsigned long sum = 0;
+    unsigned int i;
+
+    for(i = 0; i < GENERATE_COUNT; i++){
+        entropy_add(i);
+        sum += combination_generate();
+    }
+
+    *ops = GENERATE_COUNT;
+    return sum;
+}
+
+static unsigned long bench_new_game_print(unsigned long *ops){
+    unsigned int i;
+
+    hal_host_reset();
+    for(i = 0; i < MESSAGE_COUNT; i++){
+        new_game_print();
+        uart_tx_drain();
+    }
+
+    *ops = MESSAGE_COUNT;
+    return hal_host_uart_tx_count;
+}
+
+static unsigned long bench_step_results_print(unsigned long *ops){
+    unsigned int i;
+
+    hal_host_reset();
+    for(i = 0; i < MESSAGE_COUNT; i++){
+        combination_t guess = codes[i % CODE_COUNT];
+
+        step_results_print(guess, combination_check(guess, codes[CODE_COUNT / 2]), (i % 6) + 1);
+        uart_tx_drain();
+    }
+
+    *ops = MESSAGE_COUNT;
+    return hal_host_uart_tx_count;
+}
+
+static unsigned long bench_final_results_print(unsigned long *ops){
+    unsigned int i;
+
+    hal_host_reset();
+    for(i = 0; i < MESSAGE_COUNT; i++){
+        combination_t secret = codes[i % CODE_COUNT];
+
+        // pola igara se zavrsava pogotkom, pola neuspehom
+        final_results_print(secret, (i & 1) ? RESULT_WIN : RESULT_PACK(2, 1, 1));
+        uart_tx_drain();
+    }
+
+    *ops = MESSAGE_COUNT;
+    return hal_host_uart_tx_count;
+}
+
+static const struct {
+    const char *name;
+    bench_body body;
+    unsigned int (*available)(void);    // NULL - uvek dostupan
+} benchmarks[] = {
+    {"combination_check (SWAR)",    bench_check_swar,       NULL},
+    {"combination_check_reference", bench_check_reference,  NULL},
+    {"batch classes (scalar)",      bench_batch_scalar,     NULL},
+#if COMBINATION_BATCH_SIMD
+    {"batch classes (sse2)",        bench_batch_sse2,       NULL},
+    {"batch classes (avx2)",        bench_batch_avx2,       combination_batch_avx2_supported},
+#endif
+    {"combination_check_batch",     bench_check_batch,      NULL},
+    {"symbol_push",                 bench_symbol_push,      NULL},
+    {"ADC_symbol_map",              bench_adc_symbol_map,   NULL},
+    {"combination_generate",        bench_generate,         NULL},
+    {"new_game_print (message)",    bench_new_game_print,   NULL},
+    {"step_results_print (message)", bench_step_results_print, NULL},
+    {"final_results_print (message)", bench_final_results_print, NULL},
+};
+
+int main(void)
+{
+    unsigned int b, r;
+
+    codes_init(codes);
+    hal_host_reset();
+
+    printf("combination_check_batch kernel: %s\n", combination_batch_isa());
+    printf("%-30s %10s %14s %12s\n", "kernel", "ns/op", "ops/sec", "checksum");
+
+    for(b = 0; b < sizeof(benchmarks) / sizeof(benchmarks[0]); b++){
+        double best = 1e30;
+        unsigned long checksum = 0;
+        unsigned long ops = 1;
+
+        if(benchmarks[b].available != NULL && !benchmarks[b].available()){
+            printf("%-30s skipped (not supported by this CPU)\n", benchmarks[b].name);
+            continue;
+        }
+        for(r = 0; r < REPEAT_COUNT; r++){
+            double start = time_now_ns();
+            double elapsed;
+
+            checksum = benchmarks[b].body(&ops);
+            elapsed = (time_now_ns() - start) / (double)ops;
+            if(elapsed < best){
+                best = elapsed;
+            }
+        }
+        printf("%-30s %10.2f %14.0f %12lu\n", benchmarks[b].name, best, 1e9 / best, checksum);
+    }
+
+    return 0;
+}
+
+#endif /* HOST_BUILD */
@@ -0,0 +1,87 @@
+#ifdef HOST_BUILD
+/**
+ * @brief Host program skocko_host
+ *
+ * Odigrava jednu igru bez korisnika: generise se kombinacija, a zatim se
+ * za svaki pokusaj uzima predlog resavaca (isto kao komanda 'h'), odnosno slucajna
+ * kombinacija ako je resavac iskljucen za izabranu velicinu igre (SOLVER_ENABLED). Sve poruke se salju preko istih
+ * funkcija kao na mikrokontroleru (new_game_print, step_results_print,
+ * final_results_print), a softverski HAL ih ispisuje na standardni izlaz.
+ * Prekid na kraju DMA prenosa se simulira pozivanjem uart_tx_isr() dok se bafer ne isprazni.
+ *
+ */
+#include <stdio.h>
+#include <time.h>
+
+#include "combination.h"
+#include "uart_tx.h"
+#include "solver.h"
+#include "timestamp.h"
+#include "entropy.h"
+#include "hal_host.h"
+
+#define MAX_ATTEMPTS    (6)
+
+static void uart_tx_drain(void){
+    while(uart_tx_pending() > 0){
+        uart_tx_isr();
+    }
+    // poslednji "prekid" zatice prazan bafer i oslobadja predajnik
+    uart_tx_isr();
+}
+
+int main(void)
+{
+    combination_t combination;
+    unsigned int result = 0;
+    unsigned int i;
+    combination_t guess;
+#if SOLVER_ENABLED
+    unsigned long hint_start;
+#endif
+
+    hal_host_reset();
+
+    new_game_print();
+    uart_tx_drain();
+
+    // na host-u nema prekidnih rutina, pa se skup entropije puni vremenom
+    entropy_add((unsigned int)time(NULL));
+    entropy_add((unsigned int)hal_host_timestamp());
+    combination = combination_generate();
+#if SOLVER_ENABLED
+    solver_reset();
+#endif
+
+    for(i = 0; i < MAX_ATTEMPTS; i++){
+#if SOLVER_ENABLED
+        hint_start = timestamp_now();
+        guess = solver_hint();
+        hint_print(guess, solver_remaining(), TIMESTAMP_TO_MS(timestamp_now() - hint_start));
+        uart_tx_drain();
+#else
+        guess = combination_generate();
+#endif
+
+        result = combination_check(guess, combination);
+#if SOLVER_ENABLED
+        solver_record(guess, result);
+#endif
+
+        step_results_print(guess, result, i + 1);
+        uart_tx_drain();
+
+        if(result == RESULT_WIN){
+            break;
+        }
+    }
+
+    final_results_print(combination, result);
+    uart_tx_drain();
+
+    fputs(hal_host_uart_tx_log, stdout);
+
+    return 0;
+}
+
+#endif /* HOST_BUILD */
@@ -0,0 +1,456 @@
+#ifdef HOST_BUILD
+/**
+ * @brief Host program tournament
+ *
+ * Turnir strategija pogadjanja: svaka strategija odigra po jednu celu igru za svaku
+ * tajnu kombinaciju (1296 igara za igru 4 x 6), sa istom semantikom rezultata kao
+ * combination_check (pokusaj se ocenjuje protiv svih kandidata jednim pozivom
+ * combination_check_batch). Strategije:
+ * - minimax        -> najmanja najveca grupa preostalih kombinacija (Knuth)
+ * - expected-size  -> najmanja ocekivana velicina preostale grupe (suma n^2)
+ * - entropy        -> najveca entropija raspodele rezultata
+ * - random         -> slucajna kombinacija koja je jos moguca
+ *
+ * Pokusaj se bira iz svih kombinacija, osim ako bi to premasilo budzet od
+ * CHECK_BUDGET poziva combination_check po potezu; tada se bira iz ravnomerno
+ * proredjenog skupa jos mogucih kombinacija (kao u solver.c). Kod jednakih ocena
+ * prednost ima kombinacija koja je jos moguca, pa ona sa manjim indeksom.
+ * Prvi pokusaj ne zavisi od tajne kombinacije, pa se za svaku strategiju racuna samo jednom.
+ *
+ * Igre se dele na sve raspolozive niti preko pool-a sa kradjom posla: svaka nit ima
+ * svoj opseg tajnih kombinacija i uzima igre sa njegovog pocetka, a kada ga isprazni,
+ * preuzima gornju polovinu opsega druge niti. Igre traju razlicito dugo, pa ovako
+ * nijedna nit ne ceka na kraju turnira.
+ *
+ * Ispisuje se prosecan i najveci broj pokusaja, raspodela broja pokusaja i trajanje
+ * (wall-clock) za svaku strategiju.
+ *
+ * Upotreba: tournament [-s korak] [-t niti] [strategija...]
+ * - korak      -> igra se svaka korak-ta tajna kombinacija (za vece igre), podrazumevano 1
+ * - niti       -> broj niti, podrazumevano broj raspolozivih jezgara
+ * - strategija -> minimax, expected-size, entropy ili random; podrazumevano sve
+ *
+ */
+#define _POSIX_C_SOURCE 200809L
+
+#include <math.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "combination.h"
+#include "combination_batch.h"
+#include "host_util.h"
+
+#define CODE_COUNT          (COMBINATION_CODE_COUNT)
+#define RESULT_CLASSES      (COMBINATION_BATCH_CLASSES)
+#define CHECK_BUDGET        (4000000UL)
+#define MAX_THREADS         (64)
+#define MAX_ATTEMPTS        (32)    // zastita; nijedna strategija ne sme da igra duze
+
+/**
+ * @brief Ocena pokusaja
+ *
+ * Na osnovu histograma klasa rezultata vraca ocenu pokusaja; manja ocena je bolja.
+ * Za strategiju random ocena je NULL.
+ *
+ */
+typedef double (*strategy_score)(const unsigned int *histogram);
+
+static double score_minimax(const unsigned int *histogram){
+    unsigned int k, worst = 0;
+
+    for(k = 0; k < RESULT_CLASSES; k++){
+        if(histogram[k] > worst){
+            worst = histogram[k];
+        }
+    }
+    return worst;
+}
+
+static double score_expected_size(const unsigned int *histogram){
+    unsigned int k;
+    double sum = 0;
+
+    for(k = 0; k < RESULT_CLASSES; k++){
+        sum += (double)histogram[k] * histogram[k];
+    }
+    return sum;
+}
+
+// n * log2(n) za n iz [0; CODE_COUNT], da se log2 ne racuna za svaku klasu svakog pokusaja
+static double entropy_table[CODE_COUNT + 1];
+
+// entropija je -suma p log p; za isti broj kombinacija dovoljno je minimizovati suma n log n
+static double score_entropy(const unsigned int *histogram){
+    unsigned int k;
+    double sum = 0;
+
+    for(k = 0; k < RESULT_CLASSES; k++){
+        sum += entropy_table[histogram[k]];
+    }
+    return sum;
+}
+
+static const struct {
+    const char *name;
+    strategy_score score;
+} strategies[] = {
+    {"minimax",       score_minimax},
+    {"expected-size", score_expected_size},
+    {"entropy",       score_entropy},
+    {"random",        NULL},
+};
+#define STRATEGY_COUNT      (sizeof(strategies) / sizeof(strategies[0]))
+
+/**
+ * @brief Red poslova jedne niti
+ *
+ * Preostale igre niti su indeksi [next; end) u nizu tajnih kombinacija.
+ *
+ */
+struct work_queue {
+    pthread_mutex_t lock;
+    unsigned long next;
+    unsigned long end;
+};
+
+/**
+ * @brief Statistika jedne niti
+ *
+ * attempts[n] je broj igara dobijenih u n pokusaja.
+ *
+ */
+struct worker {
+    pthread_t thread;
+    unsigned int index;
+    combination_t *candidates;
+    unsigned long games;
+    unsigned long total_attempts;
+    unsigned int max_attempts;
+    unsigned long attempts[MAX_ATTEMPTS + 1];
+};
+
+static combination_t codes[CODE_COUNT];
+static struct work_queue queues[MAX_THREADS];
+static struct worker workers[MAX_THREADS];
+static unsigned int thread_count;
+static unsigned long secret_stride = 1;
+
+static unsigned int current_strategy;
+static combination_t first_guess;
+
+static void entropy_table_init(void){
+    unsigned long n;
+
+    for(n = 2; n <= CODE_COUNT; n++){
+        entropy_table[n] = n * log2((double)n);
+    }
+}
+
+// xorshift32, posebno stanje za svaku igru, pa je ishod isti bez obzira na broj niti
+static unsigned long random_next(unsigned long *state){
+    unsigned long x = *state;
+
+    x ^= (x << 13) & 0xFFFFFFFFUL;
+    x ^= x >> 17;
+    x ^= (x << 5) & 0xFFFFFFFFUL;
+    *state = x;
+    return x;
+}
+
+/**
+ * @brief Izbor sledeceg pokusaja
+ *
+ * Vraca sledeci pokusaj. Pokusaji su sve kombinacije ako je
+ * CODE_COUNT * count u okviru budzeta, a inace svaka stride-ta jos moguca kombinacija.
+ *
+ */
+static combination_t guess_choose(strategy_score score, const combination_t *candidates,
+                                  unsigned long count, unsigned long *random_state){
+    unsigned int histogram[RESULT_CLASSES];
+    unsigned long guess_count, stride, g;
+    unsigned int from_codes;
+    combination_t best = candidates[0];
+    unsigned int best_is_candidate = 0;
+    double best_score = 0;
+    unsigned long candidate = 0;
+
+    if(score == NULL){
+        return candidates[random_next(random_state) % count];
+    }
+    if(count <= 2){
+        return candidates[0];
+    }
+
+    from_codes = (unsigned long)CODE_COUNT * count <= CHECK_BUDGET;
+    if(from_codes){
+        guess_count = CODE_COUNT;
+        stride = 1;
+    }else{
+        guess_count = CHECK_BUDGET / count;
+        if(guess_count == 0){
+            guess_count = 1;
+        }
+        if(guess_count > count){
+            guess_count = count;
+        }
+        stride = count / guess_count;
+    }
+
+    for(g = 0; g < guess_count; g++){
+        combination_t guess = from_codes ? codes[g] : candidates[g * stride];
+        unsigned int is_candidate;
+        double value;
+
+        combination_check_batch(guess, candidates, count, histogram);
+
+        // candidates je sortiran kao i codes, pa se pripadnost proverava jednim prolazom
+        if(from_codes){
+            while(candidate < count && candidates[candidate] < guess){
+                candidate++;
+            }
+            is_candidate = candidate < count && candidates[candidate] == guess;
+        }else{
+            is_candidate = 1;
+        }
+
+        value = score(histogram);
+        if(g == 0 || value < best_score || (value == best_score && is_candidate && !best_is_candidate)){
+            best = guess;
+            best_score = value;
+            best_is_candidate = is_candidate;
+        }
+    }
+
+    return best;
+}
+
+// igra jednu igru i vraca broj pokusaja
+static unsigned int game_play(struct worker *self, unsigned long secret_index){
+    strategy_score score = strategies[current_strategy].score;
+    combination_t secret = codes[secret_index];
+    combination_t *candidates = self->candidates;
+    unsigned long count = CODE_COUNT;
+    unsigned long random_state = secret_index * 2654435761UL + 1;
+    unsigned int attempt;
+
+    memcpy(candidates, codes, sizeof(codes));
+
+    for(attempt = 1; attempt < MAX_ATTEMPTS; attempt++){
+        combination_t guess;
+        unsigned int result;
+        unsigned long c, kept = 0;
+
+        if(attempt == 1 && score != NULL){
+            guess = first_guess;
+        }else{
+            guess = guess_choose(score, candidates, count, &random_state);
+        }
+
+        result = combination_check(guess, secret);
+        if(result == RESULT_WIN){
+            return attempt;
+        }
+
+        for(c = 0; c < count; c++){
+            if(combination_check(guess, candidates[c]) == result){
+                candidates[kept++] = candidates[c];
+            }
+        }
+        count = kept;
+    }
+
+    return MAX_ATTEMPTS;
+}
+
+/**
+ * @brief Uzimanje sledece igre
+ *
+ * Nit prvo uzima igru sa pocetka svog reda. Ako je red prazan, trazi prvu drugu nit
+ * koja jos ima posla, preuzima gornju polovinu njenog opsega i nastavlja iz svog reda.
+ * Vraca 0 kada vise nijedna nit nema posla (novi poslovi se ne dodaju u toku turnira).
+ *
+ */
+static unsigned int work_take(unsigned int self, unsigned long *game){
+    unsigned int attempt;
+
+    for(attempt = 0; attempt < thread_count; attempt++){
+        struct work_queue *victim = &queues[(self + attempt) % thread_count];
+        unsigned long first, end;
+
+        pthread_mutex_lock(&victim->lock);
+        if(attempt == 0 && victim->next < victim->end){
+            *game = victim->next++;
+            pthread_mutex_unlock(&victim->lock);
+            return 1;
+        }
+        first = victim->next + (victim->end - victim->next) / 2;
+        end = victim->end;
+        victim->end = first;
+        pthread_mutex_unlock(&victim->lock);
+
+        if(first < end){
+            *game = first;
+            pthread_mutex_lock(&queues[self].lock);
+            queues[self].next = first + 1;
+            queues[self].end = end;
+            pthread_mutex_unlock(&queues[self].lock);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static void *worker_thread(void *argument){
+    struct worker *self = argument;
+    unsigned long game;
+
+    while(work_take(self->index, &game)){
+        unsigned int attempts = game_play(self, game * secret_stride);
+
+        self->games++;
+        self->total_attempts += attempts;
+        self->attempts[attempts]++;
+        if(attempts > self->max_attempts){
+            self->max_attempts = attempts;
+        }
+    }
+    return NULL;
+}
+
+static void usage(const char *program){
+    unsigned int s;
+
+    fprintf(stderr, "usage: %s [-s stride] [-t threads] [strategy...]\nstrategies:", program);
+    for(s = 0; s < STRATEGY_COUNT; s++){
+        fprintf(stderr, " %s", strategies[s].name);
+    }
+    fprintf(stderr, "\n");
+}
+
+int main(int argc, char **argv)
+{
+    unsigned int selected[STRATEGY_COUNT];
+    unsigned int selected_count = 0;
+    long online = sysconf(_SC_NPROCESSORS_ONLN);
+    unsigned long game_count;
+    unsigned int s, t, n;
+    int i;
+
+    for(i = 1; i < argc; i++){
+        if(strcmp(argv[i], "-s") == 0 && i + 1 < argc){
+            secret_stride = strtoul(argv[++i], NULL, 10);
+            if(secret_stride == 0){
+                usage(argv[0]);
+                return 2;
+            }
+            continue;
+        }
+        if(strcmp(argv[i], "-t") == 0 && i + 1 < argc){
+            online = strtol(argv[++i], NULL, 10);
+            if(online < 1){
+                usage(argv[0]);
+                return 2;
+            }
+            continue;
+        }
+        for(s = 0; s < STRATEGY_COUNT && strcmp(argv[i], strategies[s].name) != 0; s++);
+        if(s == STRATEGY_COUNT || selected_count == STRATEGY_COUNT){
+            usage(argv[0]);
+            return 2;
+        }
+        selected[selected_count++] = s;
+    }
+    if(selected_count == 0){
+        for(s = 0; s < STRATEGY_COUNT; s++){
+            selected[selected_count++] = s;
+        }
+    }
+
+    thread_count = (online < 1) ? 1 : (online > MAX_THREADS) ? MAX_THREADS : (unsigned int)online;
+    game_count = (CODE_COUNT + secret_stride - 1) / secret_stride;
+    codes_init(codes);
+    entropy_table_init();
+
+    printf("game %u x %u, %lu games per strategy, %u thread(s), %s scoring\n",
+           COMBINATION_LENGTH, COMBINATION_SYMBOLS, game_count, thread_count, combination_batch_isa());
+    printf("%-14s %8s %5s %9s  attempts 1..10+\n", "strategy", "average", "max", "time [s]");
+
+    for(n = 0; n < selected_count; n++){
+        unsigned long games = 0, total = 0;
+        unsigned long attempts[MAX_ATTEMPTS + 1];
+        unsigned int max_attempts = 0;
+        double start = time_now_s();
+        unsigned long random_state = 1;
+
+        current_strategy = selected[n];
+        if(strategies[current_strategy].score != NULL){
+            first_guess = guess_choose(strategies[current_strategy].score, codes, CODE_COUNT, &random_state);
+        }
+
+        for(t = 0; t < thread_count; t++){
+            pthread_mutex_init(&queues[t].lock, NULL);
+            queues[t].next = game_count * t / thread_count;
+            queues[t].end = game_count * (t + 1) / thread_count;
+
+            memset(&workers[t], 0, sizeof(workers[t]));
+            workers[t].index = t;
+            workers[t].candidates = malloc(sizeof(codes));
+            if(workers[t].candidates == NULL){
+                fprintf(stderr, "out of memory\n");
+                return 2;
+            }
+        }
+        for(t = 0; t < thread_count; t++){
+            if(pthread_create(&workers[t].thread, NULL, worker_thread, &workers[t]) != 0){
+                fprintf(stderr, "pthread_create failed\n");
+                return 2;
+            }
+        }
+
+        memset(attempts, 0, sizeof(attempts));
+        for(t = 0; t < thread_count; t++){
+            unsigned int k;
+
+            pthread_join(workers[t].thread, NULL);
+            games += workers[t].games;
+            total += workers[t].total_attempts;
+            for(k = 0; k <= MAX_ATTEMPTS; k++){
+                attempts[k] += workers[t].attempts[k];
+            }
+            if(workers[t].max_attempts > max_attempts){
+                max_attempts = workers[t].max_attempts;
+            }
+            free(workers[t].candidates);
+            pthread_mutex_destroy(&queues[t].lock);
+        }
+
+        printf("%-14s %8.4f %5u %9.3f ", strategies[current_strategy].name,
+               (double)total / games, max_attempts, time_now_s() - start);
+        for(t = 1; t <= 10; t++){
+            unsigned long count = attempts[t];
+
+            if(t == 10){
+                unsigned int k;
+
+                for(k = 11; k <= MAX_ATTEMPTS; k++){
+                    count += attempts[k];
+                }
+            }
+            printf(" %lu", count);
+        }
+        printf("\n");
+
+        if(games != game_count){
+            fprintf(stderr, "tournament: %lu of %lu games played\n", games, game_count);
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+#endif /* HOST_BUILD */
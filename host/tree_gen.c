@@ -0,0 +1,205 @@
+#ifdef HOST_BUILD
+/**
+ * @brief Host program tree_gen
+ *
+ * Generator stabla odlucivanja za komandu 'h'. Prolazi kroz celo stablo igre 6^4
+ * (semantika rezultata je ista kao kod combination_check) i u svakom cvoru bira
+ * pokusaj po Knuth-ovom minimax kriterijumu nad svih 1296 kombinacija. Kod jednakih
+ * kandidata prednost ima kombinacija koja je jos moguca, pa ona sa manjom vrednoscu.
+ *
+ * Stablo se upisuje kao konstantna tabela u decision_tree.c, zajedno sa tabelom
+ * klasa rezultata i brojem cvorova. Deca jednog cvora su u tabeli uvek jedno do drugog,
+ * pa je u cvoru dovoljan indeks prvog deteta i maska klasa rezultata za koje dete postoji.
+ * Velicina tabele se ispisuje prilikom generisanja.
+ *
+ * Generator radi samo za podrazumevanu igru 4 x 6 (DECISION_TREE_AVAILABLE).
+ *
+ * Upotreba: tree_gen <decision_tree.c>
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "combination.h"
+#include "decision_tree.h"
+#include "host_util.h"
+
+#define CODE_COUNT      (COMBINATION_CODE_COUNT)
+#define MAX_NODES       (8192)
+
+static combination_t codes[CODE_COUNT];
+static unsigned char result_classes[DECISION_TREE_RESULT_SLOTS];
+static decision_tree_node nodes[MAX_NODES];
+static unsigned int node_count = 0;
+static unsigned int max_depth = 0;
+static unsigned long total_guesses = 0;
+
+static unsigned int result_slot(unsigned int result){
+    return RESULT_SCORED(result) * 5 + RESULT_WRONG_PLACE(result);
+}
+
+// numerise moguce rezultate (osim pogotka) redom 0..12; nemoguci rezultati dobijaju 0xFF
+static void result_classes_init(void){
+    unsigned int scored, wrong_place, k = 0;
+
+    for(scored = 0; scored <= 4; scored++){
+        for(wrong_place = 0; wrong_place <= 4; wrong_place++){
+            unsigned int slot = scored * 5 + wrong_place;
+
+            if(scored + wrong_place > 4 || (scored == 3 && wrong_place == 1) || scored == 4){
+                result_classes[slot] = DECISION_TREE_NO_CLASS;
+            }else{
+                result_classes[slot] = (unsigned char)k++;
+            }
+        }
+    }
+}
+
+static combination_t minimax_guess(const combination_t *candidates, unsigned int count){
+    unsigned int histogram[DECISION_TREE_RESULT_SLOTS];
+    unsigned int g, c, k;
+    combination_t best_guess = codes[0];
+    unsigned int best_worst = ~0u;
+    int best_is_candidate = 0;
+
+    for(g = 0; g < CODE_COUNT; g++){
+        unsigned int worst = 0;
+        int is_candidate = 0;
+
+        for(k = 0; k < DECISION_TREE_RESULT_SLOTS; k++){
+            histogram[k] = 0;
+        }
+        for(c = 0; c < count; c++){
+            unsigned int result = combination_check(codes[g], candidates[c]);
+
+            if(result == RESULT_WIN){
+                is_candidate = 1;
+            }
+            if(++histogram[result_slot(result)] > worst){
+                worst = histogram[result_slot(result)];
+            }
+        }
+
+        if(worst < best_worst || (worst == best_worst && is_candidate && !best_is_candidate)){
+            best_worst = worst;
+            best_guess = codes[g];
+            best_is_candidate = is_candidate;
+        }
+    }
+    return best_guess;
+}
+
+// razvija cvor index za dati skup mogucih kombinacija; depth je redni broj pokusaja u cvoru
+static void expand(unsigned int index, const combination_t *candidates, unsigned int count, unsigned int depth){
+    combination_t *partition[DECISION_TREE_CLASSES] = {0};
+    unsigned int partition_count[DECISION_TREE_CLASSES] = {0};
+    combination_t guess;
+    unsigned int c, k, child;
+
+    guess = (count == 1) ? candidates[0] : minimax_guess(candidates, count);
+
+    nodes[index].guess = (uint16_t)guess;
+    nodes[index].first_child = 0;
+    nodes[index].children = 0;
+
+    for(c = 0; c < count; c++){
+        unsigned int result = combination_check(guess, candidates[c]);
+
+        if(result == RESULT_WIN){
+            // kombinacija je pogodjena u ovom pokusaju
+            total_guesses += depth;
+            if(depth > max_depth){
+                max_depth = depth;
+            }
+            continue;
+        }
+
+        k = result_classes[result_slot(result)];
+        if(partition[k] == NULL){
+            partition[k] = malloc(count * sizeof(combination_t));
+        }
+        partition[k][partition_count[k]++] = candidates[c];
+    }
+
+    // deca se alociraju kao jedan blok, pa su u tabeli jedno do drugog
+    child = node_count;
+    for(k = 0; k < DECISION_TREE_CLASSES; k++){
+        if(partition_count[k] > 0){
+            nodes[index].children |= (uint16_t)(1u << k);
+            node_count++;
+        }
+    }
+    if(node_count > MAX_NODES){
+        fprintf(stderr, "tree_gen: more than %d nodes\n", MAX_NODES);
+        exit(1);
+    }
+    if(nodes[index].children){
+        nodes[index].first_child = (uint16_t)child;
+    }
+
+    for(k = 0; k < DECISION_TREE_CLASSES; k++){
+        if(partition_count[k] > 0){
+            expand(child++, partition[k], partition_count[k], depth + 1);
+            free(partition[k]);
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    FILE *source;
+    unsigned int i;
+    unsigned long bytes;
+
+    if(argc != 2){
+        fprintf(stderr, "usage: %s <decision_tree.c>\n", argv[0]);
+        return 2;
+    }
+    if(!DECISION_TREE_AVAILABLE){
+        fprintf(stderr, "tree_gen: decision tree is only generated for the 4 x 6 game\n");
+        return 2;
+    }
+
+    codes_init(codes);
+    result_classes_init();
+    node_count = 1;
+    expand(0, codes, CODE_COUNT, 1);
+
+    bytes = (unsigned long)node_count * sizeof(decision_tree_node);
+
+    source = fopen(argv[1], "w");
+    if(source == NULL){
+        perror("tree_gen");
+        return 1;
+    }
+
+    fprintf(source, "/*\n * Automatski generisan fajl (host/tree_gen.c). Ne menjati rucno.\n"
+                    " * %u cvorova, %lu bajtova, najvise %u pokusaja, prosecno %.3f pokusaja.\n */\n",
+            node_count, bytes, max_depth, (double)total_guesses / CODE_COUNT);
+    fprintf(source, "#include \"decision_tree.h\"\n\n");
+    fprintf(source, "#if DECISION_TREE_AVAILABLE\n\n");
+    fprintf(source, "const unsigned int decision_tree_node_count = %u;\n\n", node_count);
+    fprintf(source, "// klasa rezultata za indeks 5 * tacni + na pogresnom mestu (0xFF - nemoguc rezultat ili pogodak)\n");
+    fprintf(source, "const unsigned char decision_tree_class[DECISION_TREE_RESULT_SLOTS] = {\n       ");
+    for(i = 0; i < DECISION_TREE_RESULT_SLOTS; i++){
+        fprintf(source, " 0x%02X%s", result_classes[i], (i + 1 < DECISION_TREE_RESULT_SLOTS) ? "," : "\n");
+    }
+    fprintf(source, "};\n\n");
+    fprintf(source, "// stablo odlucivanja: {pokusaj, indeks prvog deteta, maska klasa rezultata sa decom}\n");
+    fprintf(source, "const decision_tree_node decision_tree[] = {\n");
+    for(i = 0; i < node_count; i++){
+        fprintf(source, "        {0x%04X, %4u, 0x%04X}%s\n", nodes[i].guess, nodes[i].first_child,
+                nodes[i].children, (i + 1 < node_count) ? "," : "");
+    }
+    fprintf(source, "};\n\n");
+    fprintf(source, "#endif /* DECISION_TREE_AVAILABLE */\n");
+    fclose(source);
+
+    printf("decision tree: %u nodes, %lu bytes, max %u guesses, avg %.3f guesses\n",
+           node_count, bytes, max_depth, (double)total_guesses / CODE_COUNT);
+
+    return 0;
+}
+
+#endif /* HOST_BUILD */
@@ -15,27 +15,111 @@
  *
  */
 #include <combination.h>
+/**
+ * @brief Header fajl uart_tx.h
+ *
+ * Header fajl <uart_tx.h> sadrzi kruzni bafer za slanje poruka preko serijske veze.
+ *
+ */
+#include <uart_tx.h>
+/**
+ * @brief Header fajlovi solver.h i timestamp.h
+ *
+ * Header fajl <solver.h> sadrzi resavac koji predlaze sledeci pokusaj (komanda 'h'),
+ * a <timestamp.h> vremenske oznake kojima se meri trajanje racunanja predloga.
+ *
+ */
+#include <solver.h>
+#include <timestamp.h>
+/**
+ * @brief Header fajl entropy.h
+ *
+ * Header fajl <entropy.h> sadrzi skup entropije koji pune prekidne rutine
+ * (ivice tastera, prijem preko UART-a, sum AD konverzije), a koristi combination_generate.
+ *
+ */
+#include <entropy.h>
+/**
+ * @brief Header fajl profile.h
+ *
+ * Header fajl <profile.h> sadrzi opciono merenje trajanja prekidnih rutina i stanja
+ * (prevodjenje sa --define=PROFILE, tabela na komandu 'p'). Bez tog simbola ne generise kod.
+ *
+ */
+#include <profile.h>
+/**
+ * @brief Header fajl clock.h
+ *
+ * Header fajl <clock.h> sadrzi podesavanje takta (UCS/FLL) i delioce za zadatu brzinu
+ * serijske veze, koji se racunaju pri prevodjenju.
+ *
+ */
+#include <clock.h>
+/**
+ * @brief Header fajlovi uart_rx.h i command.h
+ *
+ * Header fajl <uart_rx.h> sadrzi kruzni bafer u koji UART prekidna rutina upisuje primljene
+ * bajtove, a <command.h> parser koji od tih bajtova sastavlja komande (command.c).
+ *
+ */
+#include <uart_rx.h>
+#include <command.h>
+/**
+ * @brief Header fajl frame.h
+ *
+ * Header fajl <frame.h> sadrzi binarni protokol kojim test okruzenje salje vise pokusaja
+ * u jednom okviru i dobija po jedan bajt rezultata za svaki pokusaj.
+ *
+ */
+#include <frame.h>
+/**
+ * @brief Header fajl event.h
+ *
+ * Header fajl <event.h> sadrzi red dogadjaja kojim prekidna rutina za tastere prijavljuje
+ * pritiske glavnom programu, koji je jedini vlasnik stanja.
+ *
+ */
+#include <event.h>
 /**
  * @brief Perioda tajmera
  *
  * Tajmer je "klokovan" sa ACLK takt signalom frekvencije 32768Hz.
- * Koristeci 1023 periode tog takt signala dobijamo periodu naseg tajmer od oko 32ms,
- * sto je sasvim dovoljno za realizaciju zadatka.
+ * Koristeci 64 periode tog takt signala dobijamo periodu naseg tajmera od oko 1.95ms.
+ * U svakoj periodi prekidna rutina osvezava sledeci LED displej, pa se sva 4 displeja
+ * osvezavaju ucestanoscu od 128Hz (bez treperenja). Izlaz TA0.1 (CCR1) u svakoj
+ * periodi hardverski pokrece po jednu AD konverziju, bez ucesca procesora.
  *
- * Prekidna rutina za tajmer koji pokrece AD konverziju realizovana je u fajlu ISR.asm
+ * Prekidna rutina za tajmer realizovana je u fajlu ISR.asm
  *
  */
-#define TIMER_PERIOD        (1023)
+#define TIMER_PERIOD        (63)
+
+#if (TIMER_PERIOD + 1) != TIMESTAMP_PERIOD
+#error "TIMESTAMP_PERIOD u timestamp.h mora biti TIMER_PERIOD + 1"
+#endif
 /**
  * @brief Rezultat AD konverzije
  *
  * Promenljiva ad_result sa koristi kao memorijska lokacija za smestanje
- * rezultata AD konverzije sa analognog ulaza od potenciometra P1.
- * Upisivanje rezultata AD konverzije u ovu promenljivu realizovano je u
- * prekidnoj rutini AD konvertora koja se nalazi u fajlu ISR.asm
+ * usrednjenog rezultata AD konverzije sa analognog ulaza od potenciometra P1.
+ * AD konvertor radi u repeat-sequence modu kroz ADC_SAMPLES memorijskih lokacija
+ * (MEM0 do MEM7), a svaku konverziju pokrece tajmer preko ADC12SHS. Prekid se javlja
+ * tek kada se popuni poslednja lokacija, tj. jednom na ADC_SAMPLES odbiraka (oko 15.6ms),
+ * i tada se odbirci usrednjavaju. Upisivanje rezultata u ovu promenljivu realizovano
+ * je u prekidnoj rutini AD konvertora koja se nalazi u fajlu ISR.asm
  *
  */
+#define ADC_SAMPLES         (8)
 volatile unsigned int ad_result = 0x0;
+/**
+ * @brief Simbol izabran potenciometrom
+ *
+ * Prekidna rutina AD konvertora (ISR.asm) nakon svakog usrednjavanja poziva
+ * ADC_symbol_map sa prethodnim simbolom, pa ova promenljiva uvek sadrzi simbol
+ * sa primenjenim histerezisom. Glavni program je samo cita klikom na taster S2.
+ *
+ */
+volatile unsigned int ad_symbol = 1;
 /**
  * @brief Stanja
  *
@@ -51,14 +135,19 @@ const enum states{IDLE =  1, WAIT_FOR_NEW_GAME, GENERATE_COMBINATION, START, SEL
  * Aplikacija pocinje sa ovim stanjem. Ovo stanje nema znacajnu funkcionalnost.
  * Koristi se za cekanje karaktera preko serijske veze kojim se zapocinje nova igra.
  *
+ * Stanje menja i cita samo glavni program. Prekidne rutine ne diraju stanje, vec
+ * dogadjaje upisuju u svoje redove (button_events, uart_rx.c), a glavni program ih
+ * obradjuje (events_process, commands_process).
+ *
  */
-volatile unsigned int current_state = IDLE;
+unsigned int current_state = IDLE;
 /**
  * @brief Promeljive vezane za kombinacije
  *
  * Upotrebljene su integer-ske promenljive umesto nizova, da se ne bi upotrebio
  * preveliki memorijski prostor, i to na sledeci nacin:
- * Kombinacija ima oblik : 4556, a ne [4, 5, 5, 6].
+ * Kombinacija ima oblik : 0x4556 (4 bita po simbolu), a ne [4, 5, 5, 6].
+ * Makroi za pakovanje i raspakivanje se nalaze u combination.h (COMBINATION_SYMBOL).
  *
  * Simboli izabrani preko analognog kanala su mapirani na simbole iz skupa {1, 2, 3, 4, 5, 6}.
  * Nula predstavlja prazno mesto, pa tako ukoliko na LED displeju pise nula na nekoj poziciji,
@@ -72,15 +161,18 @@ volatile unsigned int current_state = IDLE;
  * - current_combination_index -> promenljiva u kojoj se smesta indeks trenutne cifre u kombinaciji
  * - cnt_attempts              -> promenljiva u kojoj se smesta broj pokusaja u toku jedne igre.
  *
- * Promenljiva result je takodje int, umesto niza. U njoj se smestaju 3 vrednosti i to
- * na sledeci nacin: result = 301, znaci da imamo 3 tacna simbola (pogodjen simbol i mesto tog simbola)
- * i 1 netacan simbol; result = 220, znaci da imamo 2 tacna simbola i 2 simbola koji nisu na dobrom mestu.
- * Konacno, result = 400 znaci da imamo sva 4 simbola tacno pogodjena.
+ * Promenljiva result je takodje int, umesto niza. U njoj se smestaju 3 vrednosti po 4 bita i to
+ * na sledeci nacin: result = 0x301, znaci da imamo 3 tacna simbola (pogodjen simbol i mesto tog simbola)
+ * i 1 netacan simbol; result = 0x220, znaci da imamo 2 tacna simbola i 2 simbola koji nisu na dobrom mestu.
+ * Konacno, result = RESULT_WIN (0x400) znaci da imamo sva 4 simbola tacno pogodjena.
  *
  * Promenljiva current_combinaton_index nam, kao sto je receno govori o indeksu, odnosno rednom broju
  * cifre koju smestamo u trenutnu kombinaciju.
- * Npr: current_combination_index = 4 znaci da smestamo najtezi broj, tj. prvu cifru sleva
- * u cetvorocifrenoj kombinaciji.
+ * Npr: current_combination_index = COMBINATION_LENGTH (4 u podrazumevanoj igri) znaci da smestamo
+ * najtezi broj, tj. prvu cifru sleva u kombinaciji.
+ *
+ * Duzina kombinacije i broj simbola se biraju u vreme prevodjenja (COMBINATION_LENGTH i
+ * COMBINATION_SYMBOLS u combination.h); kombinacije su tipa combination_t.
  *
  * Promenljiva cnt_attempts broji pokusaje u toku jedne igre do 6. Ukoliko se stiglo do
  * 6. pokusaja i kombinacija nije pogodjena, igra se zavrsava.
@@ -96,57 +188,438 @@ volatile unsigned int current_state = IDLE;
  * - combination_check()
  *
  */
-volatile unsigned int combination = 0;
-volatile unsigned int current_combination = 0;
+volatile combination_t combination = 0;
+volatile combination_t current_combination = 0;
 volatile unsigned int current_symbol = 0;
 volatile unsigned int result = 0;
-volatile unsigned int current_combination_index = 4;
+volatile unsigned int current_combination_index = COMBINATION_LENGTH;
 volatile unsigned int cnt_attempts = 0;
 /**
  * @brief LED displej multipleksiranje
  *
- * Kako je potrebno uraditi multipleksiranje LED displeja preko selekcionih signala
- * korisiti se promenljiva display_index za pracenje trenutno aktivnog SEL signala.
- * Pocetno je ova promenljiva postavljena na 4, sto oznacava da se prvo ispisuje na LED
- * displej prvi sleva, tj.  da se prvo ispisuje najteza cifra u cetvorocirfenoj kombinaciji.
+ * Multipleksiranje LED displeja preko selekcionih signala radi prekidna rutina tajmera
+ * (CCR0ISR u ISR.asm) iz bafera display_framebuffer. Glavni program samo upisuje simbole
+ * u bafer preko funkcija LED_display_print i display_clear, realizovanih u fajlu
+ * combination.c, a ukljucenih preko header fajla combination.h
  *
- * Funkcija za ispisivanje na LED displej (LED_display_print) realizovana je u fajlu combination.c, a ukljucena
- * preko header fajla combination.h
+ * - display_scan         -> indeks displeja koji prekidna rutina sledeci ispisuje [0;3]
+ * - display_select_p11   -> selekcioni biti na portu P11 za pozicije 0..3 u baferu
+ * - display_select_p10   -> selekcioni biti na portu P10 za pozicije 0..3 u baferu
  *
  */
-volatile unsigned int display_index = 4;
+volatile unsigned int display_scan = 0;
+const unsigned char display_select_p11[DISPLAY_DIGITS] = {BIT1, BIT0, 0, 0};
+const unsigned char display_select_p10[DISPLAY_DIGITS] = {0, 0, BIT7, BIT6};
+/**
+ * @brief Debounce tastera
+ *
+ * Prekidna rutina porta P2 samo belezi koji tasteri su okinuli (debounce_pins),
+ * iskljucuje im interrupt i ukljucuje poredjenje CCR2 tajmera TA0. Prekid CCR2 se
+ * javlja jednom po periodi tajmera, pa se nakon DEBOUNCE_PERIODS perioda (oko 15.6ms)
+ * ponovo cita P2IN i tek tada se prijavljuje pritisak tastera. Na taj nacin nijedna
+ * prekidna rutina ne ceka da se kontakt smiri.
+ *
+ */
+#define DEBOUNCE_PERIODS    (8)
+volatile unsigned char debounce_pins = 0;
+volatile unsigned int debounce_count = 0;
 /**
  * @brief Serijska komunikacija USCI-UART
  *
- * Promenljiva input_character sluzi za smestanje ucitanog karatera iz RX bafera prilikom
- * serijske komunikacije. Ukoliko je masina stanja trenutno u stanju IDLE ili END i iz RX bafera
- * je ucitan karakter 'n' onda se prelazi u novo stanje u kojem se ceka klik na tasteru S3 za
- * nove igre.
- * Sledece promenljive:
- * - new_game_string_length
- * - step_result_string_length
- * - final_result_string_length,
- * sluze za pracenje trenutne duzine poruke koja treba da se posalje preko serijske veze.
- * Kako se poruka salje preko interrupt-a, karakter po karakter preko TX bafera, onda je
- * dobar pristup da se pracenjem duzine poruke salje odgovarajuci karakter.
- *
- * Funkcije za slanje poruka preko serijske veze u zavisnosti od stanja nalaze se combination.c
- * fajlu. To su sledece funkcije:
+ * UART prekidna rutina samo upisuje primljen bajt u kruzni bafer (uart_rx.c). Glavni program
+ * bajtove prosledjuje parseru komandi (command.c) i izvrsava prepoznate komande
+ * (commands_process). Ukoliko je masina stanja trenutno u stanju IDLE ili END i primljena je
+ * komanda 'n', prelazi se u novo stanje u kojem se ceka klik na tasteru S3 (ili ponovo 'n')
+ * za novu igru.
+ *
+ * Poruke se salju preko kruznog bafera iz uart_tx.c: glavni program upisuje celu poruku
+ * odjednom, a DMA kanal 0 je prenosi u TX bafer (uart_tx_start, DMA_interrupt).
+ * Funkcije koje pripremaju poruke nalaze se u combination.c fajlu. To su sledece funkcije:
  * - new_game_print()
  * - step_results_print()
  * - final_results_print()
  *
+ * Statistika i greske komandi:
+ * - games_played      - broj zapocetih igara od pokretanja
+ * - games_won         - broj dobijenih igara od pokretanja
+ * - stats_requested   - primljena je komanda 's', poruka sa statistikom jos nije poslata
+ * - error_requested   - primljena je neispravna komanda, poruka o gresci jos nije poslata
+ *
+ */
+unsigned int games_played = 0;
+unsigned int games_won = 0;
+unsigned int stats_requested = 0;
+unsigned int error_requested = 0;
+/**
+ * @brief Odgovor na binarni okvir
+ *
+ * - frame_scores          - rezultati pokusaja iz poslednjeg okvira (FRAME_SCORE)
+ * - frame_reply_count     - broj rezultata, ili FRAME_COUNT_ERROR
+ * - frame_reply_pending   - odgovor jos nije upisan u bafer za slanje; dok je postavljen,
+ *                           glavni program ne cita nove bajtove iz bafera za prijem
+ *
+ */
+unsigned char frame_scores[FRAME_GUESSES_MAX];
+unsigned int frame_reply_count = 0;
+unsigned int frame_reply_pending = 0;
+/**
+ * @brief Finalni rezultat
+ *
+ * Promenljiva final_result_printed oznacava da je poruka sa finalnim rezultatom igre
+ * upisana u bafer za slanje, kako se u stanju END ne bi upisivala vise puta.
+ * Vreme aktivnog rada i spavanja se izracuna u trenutku upisa finalnog rezultata
+ * (power_active_ms, power_sleep_ms), a power_stats_pending oznacava da ta poruka
+ * jos nije stala u bafer za slanje i da se upis ponavlja.
+ *
+ */
+volatile unsigned int final_result_printed = 0;
+unsigned int power_stats_pending = 0;
+unsigned long power_active_ms = 0;
+unsigned long power_sleep_ms = 0;
+/**
+ * @brief Predlog sledeceg pokusaja
+ *
+ * Promenljivu hint_requested postavlja glavni program kada se u toku igre primi
+ * komanda 'h'. Glavni program tada pomocu resavaca (solver.c) racuna predlog po
+ * minimax kriterijumu i salje ga zajedno sa brojem mogucih kombinacija i trajanjem racunanja.
+ *
+ */
+volatile unsigned int hint_requested = 0;
+/**
+ * @brief Rezim niske potrosnje
+ *
+ * Glavni program ne "vrti" petlju, vec kada nema posla (main_work_pending) uvodi procesor
+ * u rezim niske potrosnje. Prekidne rutine ga bude (__bic_SR_register_on_exit) samo kada
+ * promene stanje ili postave zahtev koji glavni program treba da obradi:
+ * - LPM3 -> u stanju WAIT_FOR_NEW_GAME, kada se ceka samo taster S3 i UART ne salje nista
+ *           (ACLK za tajmer ostaje ukljucen, SMCLK se gasi)
+ * - LPM0 -> u svim ostalim stanjima, jer UART za prijem i slanje koristi SMCLK
+ *
+ * Za merenje se koriste vremenske oznake (timestamp.h):
+ * - game_start_time  -> trenutak pocetka igre
+ * - sleep_ticks      -> ukupno vreme u rezimu niske potrosnje od pocetka igre (ACLK periode)
+ * - wake_on_tx       -> poruka nije stala u bafer za slanje, pa UART prekidna rutina treba
+ *                       da probudi glavni program kada se bafer isprazni
+ * Na kraju igre se salje poruka sa vremenom aktivnog rada i vremenom spavanja.
+ *
+ */
+volatile unsigned long game_start_time = 0;
+volatile unsigned long sleep_ticks = 0;
+volatile unsigned int wake_on_tx = 0;
+/**
+ * @brief Dogadjaji tastera
+ *
+ * - button_events       - red u koji Debounce_interrupt upisuje pritiske tastera S2 i S3
+ * - event_latency_max   - najvece kasnjenje od upisa dogadjaja do obrade (ACLK periode)
+ *
+ */
+event_queue button_events;
+unsigned int event_latency_max = 0;
+/**
+ * @brief Funkcija main_work_pending
+ *
+ * - opis:
+ *      Funkcija proverava da li glavni program ima posla u trenutnom stanju.
+ *
+ * - povratna vrednost:
+ *      1 ako ima posla, 0 ako moze da spava do sledeceg prekida.
+ *
  */
-volatile char input_character = 'x';
-volatile unsigned int new_game_string_length = 18;
-volatile unsigned int step_result_string_length = 17;
-volatile unsigned int final_result_string_length = 46;
+static unsigned int main_work_pending(void){
+    if(wake_on_tx){
+        // bafer se mozda ispraznio pre nego sto je oznaka postavljena
+        if(uart_tx_pending() == 0){
+            wake_on_tx = 0;
+            return 1;
+        }
+        return 0;
+    }
+    if(hint_requested || stats_requested || error_requested || frame_reply_pending || power_stats_pending){
+        return 1;
+    }
+    if(uart_rx_pending()){
+        return 1;
+    }
+#ifdef PROFILE
+    if(profile_dump_pending()){
+        return 1;
+    }
+#endif
+    switch(current_state){
+        case GENERATE_COMBINATION:
+        case START:
+        case PROCESS_SYMBOL:
+        case PRINT_RESULT:
+            return 1;
+        case END:
+            return !final_result_printed || event_pending(&button_events);
+        default:
+            return event_pending(&button_events) != 0;
+    }
+}
+/**
+ * @brief Funkcija main_sleep
+ *
+ * - opis:
+ *      Funkcija uvodi procesor u LPM0 ili LPM3 ukoliko glavni program nema posla.
+ *      Provera i ulazak u rezim niske potrosnje se rade sa zabranjenim prekidima, kako se
+ *      ne bi "propustio" prekid koji stigne izmedju provere i spavanja. Vreme provedeno
+ *      u rezimu niske potrosnje se dodaje na sleep_ticks.
+ *
+ */
+static void main_sleep(void){
+    unsigned long sleep_start = timestamp_now();
+
+    __disable_interrupt();
+    if(main_work_pending()){
+        __enable_interrupt();
+        return;
+    }
+
+    if(current_state == WAIT_FOR_NEW_GAME && uart_tx_pending() == 0 && (UCA0STAT & UCBUSY) == 0){
+        __bis_SR_register(LPM3_bits | GIE);
+    }else{
+        __bis_SR_register(LPM0_bits | GIE);
+    }
+
+    sleep_ticks += timestamp_now() - sleep_start;
+}
+/**
+ * @brief Funkcija game_start
+ *
+ * - opis:
+ *      Funkcija zapocinje novu igru: generise kombinaciju, resetuje resavac i brojac
+ *      pokusaja i prelazi u stanje START.
+ *
+ */
+static void game_start(void){
+    combination = combination_generate();
+#if SOLVER_ENABLED
+    solver_reset();
+#endif
+
+    game_start_time = timestamp_now();
+    sleep_ticks = 0;
+
+    cnt_attempts = 0;
+    games_played++;
+
+    current_combination = 0;
+    current_combination_index = COMBINATION_LENGTH;
+    current_state = START;
+}
+/**
+ * @brief Funkcija attempt_finish
+ *
+ * - opis:
+ *      Funkcija zavrsava pokusaj cija je kombinacija (current_combination) kompletna,
+ *      bilo da je izabrana potenciometrom i tasterom S2 ili otkucana preko serijske veze:
+ *      zaustavlja AD konverzije, proverava kombinaciju i prelazi u stanje PRINT_RESULT.
+ *
+ */
+static void attempt_finish(void){
+    ADC12CTL0 &= ~ADC12ENC;  // sekvenca se zavrsava i AD konvertor miruje do sledeceg pokusaja
+    cnt_attempts++;
+    result = combination_check(current_combination, combination);
+#if SOLVER_ENABLED
+    solver_record(current_combination, result);
+#endif
+
+    current_combination_index = COMBINATION_LENGTH;
+    current_state = PRINT_RESULT;
+}
+/**
+ * @brief Funkcija game_over
+ *
+ * - opis:
+ *      Funkcija proverava da li je poslednjim pokusajem igra zavrsena (pogodak ili
+ *      iskorisceni svi pokusaji) i broji dobijene igre.
+ *
+ * - povratna vrednost:
+ *      1 ako je igra zavrsena, inace 0.
+ *
+ */
+static unsigned int game_over(void){
+    if(result == RESULT_WIN){
+        games_won++;
+        return 1;
+    }
+    return cnt_attempts == 6;
+}
+/**
+ * @brief Funkcija frame_guesses_score
+ *
+ * - opis:
+ *      Funkcija redom ocenjuje pokusaje iz primljenog okvira kao pokusaje trenutne igre
+ *      i priprema odgovor. Tekstualne poruke o rezultatu se ne salju; kada se igra zavrsi,
+ *      ostali pokusaji iz okvira dobijaju FRAME_SCORE_NONE.
+ *
+ */
+static void frame_guesses_score(void){
+    unsigned int i;
+    combination_t guess;
+
+    frame_reply_count = frame_guess_count();
+    for(i = 0; i < frame_reply_count; i++){
+        guess = frame_guess(i);
+        if(guess == COMBINATION_INVALID || current_state < START || current_state > PROCESS_SYMBOL){
+            frame_scores[i] = FRAME_SCORE_NONE;
+            continue;
+        }
+
+        current_combination = guess;
+        attempt_finish();
+        frame_scores[i] = FRAME_SCORE(result);
+
+        if(game_over()){
+            final_result_printed = 1;
+            current_state = END;
+        }else{
+            current_state = START;
+        }
+    }
+    frame_reply_pending = 1;
+}
+/**
+ * @brief Funkcija events_process
+ *
+ * - opis:
+ *      Funkcija obradjuje dogadjaje tastera u stanjima u kojima se ceka korisnik (IDLE,
+ *      WAIT_FOR_NEW_GAME, SELECT_SYMBOL, END), i to samo do prve promene stanja, kako bi
+ *      glavni program obradio novo stanje pre sledeceg dogadjaja. U prelaznim stanjima
+ *      dogadjaji ostaju u redu, pa se ni brzi niz pritisaka ne gubi. Za svaki dogadjaj
+ *      meri se kasnjenje od prekidne rutine do obrade.
+ *
+ */
+static void events_process(void){
+    unsigned int previous_state = current_state;
+    event_t event;
+    unsigned int latency;
+
+    if(current_state != IDLE && current_state != WAIT_FOR_NEW_GAME
+            && current_state != SELECT_SYMBOL && current_state != END){
+        return;
+    }
+
+    while(current_state == previous_state && event_get(&button_events, &event)){
+        latency = (uint16_t)timestamp_now() - event.time;
+        if(latency > event_latency_max){
+            event_latency_max = latency;
+        }
+
+        switch(event.type){
+            case EVENT_BUTTON_S2:
+                // simbol je izabran u trenutku pritiska, a ne u trenutku obrade
+                if(current_state == SELECT_SYMBOL){
+                    current_symbol = event.data;
+                    current_state = PROCESS_SYMBOL;
+                }
+                break;
+            case EVENT_BUTTON_S3:
+                if(current_state == WAIT_FOR_NEW_GAME){
+                    current_state = GENERATE_COMBINATION;
+                }
+                break;
+        }
+    }
+}
+/**
+ * @brief Funkcija commands_process
+ *
+ * - opis:
+ *      Funkcija prosledjuje primljene bajtove parseru (command_feed) i izvrsava
+ *      prepoznate komande. Komanda koja nije dozvoljena u trenutnom stanju (npr. pokusaj
+ *      van igre) prijavljuje se kao greska.
+ *      Kao i events_process, funkcija staje posle prve promene stanja, a u prelaznim
+ *      stanjima GENERATE_COMBINATION i PRINT_RESULT ne cita nista, pa ostali bajtovi
+ *      (npr. sledeci zalepljen pokusaj ili 'h') cekaju u baferu dok glavni program ne
+ *      obradi novo stanje.
+ *
+ */
+static void commands_process(void){
+    unsigned int previous_state = current_state;
+    unsigned char character;
+    unsigned long argument = 0;
+    unsigned int i;
+
+    if(current_state == GENERATE_COMBINATION || current_state == PRINT_RESULT){
+        return;
+    }
+
+    while(!frame_reply_pending && current_state == previous_state && uart_rx_read(&character)){
+        if(frame_active() || character == FRAME_SYNC){
+            switch(frame_feed(character)){
+                case FRAME_GUESSES:
+                    frame_guesses_score();
+                    break;
+                case FRAME_NEW_GAME:
+                    game_start();
+                    frame_reply_count = 0;
+                    frame_reply_pending = 1;
+                    break;
+                case FRAME_ERROR:
+                    frame_reply_count = FRAME_COUNT_ERROR;
+                    frame_reply_pending = 1;
+                    break;
+            }
+            continue;
+        }
+
+        switch(command_feed((char)character, &argument)){
+            case COMMAND_NEW_GAME:
+                if(current_state == IDLE || current_state == END){
+                    final_result_printed = 0;
+                    current_state = WAIT_FOR_NEW_GAME;
+                }else if(current_state == WAIT_FOR_NEW_GAME){
+                    current_state = GENERATE_COMBINATION;
+                }
+                break;
+            case COMMAND_HINT:
+#if SOLVER_ENABLED
+                if(current_state >= START && current_state <= PROCESS_SYMBOL){
+                    hint_requested = 1;
+                }
+#endif
+                break;
+            case COMMAND_PROFILE:
+#ifdef PROFILE
+                profile_dump_start();
+#endif
+                break;
+            case COMMAND_GUESS:
+                if(current_state >= START && current_state <= PROCESS_SYMBOL){
+                    // otkucana kombinacija zamenjuje simbole koji su eventualno vec izabrani
+                    current_combination = (combination_t)argument;
+                    for(i = COMBINATION_LENGTH; i > 0; i--){
+                        LED_display_print(i, COMBINATION_SYMBOL(current_combination, i - 1));
+                    }
+                    attempt_finish();
+                }else{
+                    error_requested = 1;
+                }
+                break;
+            case COMMAND_STATS:
+                stats_requested = 1;
+                break;
+            case COMMAND_SEED:
+                combination_seed_set((unsigned int)argument);
+                break;
+            case COMMAND_INVALID:
+                error_requested = 1;
+                break;
+        }
+    }
+}
 
 
 int main(void)
 {
+    unsigned int i;
+
 	WDTCTL = WDTPW | WDTHOLD;	// stop watchdog timer
 
+    clock_init();               // MCLK = SMCLK = CLOCK_MCLK_HZ (FLL), ACLK ostaje 32768 Hz
+
 	/**
      *
      * Tasteri S2 i S3
@@ -196,6 +669,9 @@ int main(void)
 
     TA0CCR0 = TIMER_PERIOD;
     TA0CCTL0 = CCIE;
+    TA0CCR1 = TIMER_PERIOD / 2;         // TA0.1 (set/reset) daje jednu rastucu ivicu po periodi,
+    TA0CCTL1 = OUTMOD_3;                // koja je okidac za AD konvertor
+    TA0CCR2 = 0;                        // CCR2 meri debounce interval tastera (CCIE se ukljucuje po potrebi)
     TA0CTL = TASSEL__ACLK | MC__UP;
 
     /**
@@ -205,11 +681,14 @@ int main(void)
      */
 
     P7SEL |= BIT6;                      // Potenciometar 1 (P1) koristim za analogno citanje napona - A14
-    ADC12CTL0 = ADC12ON | ADC12SHT0_8;  // ukljucujem AD konvertor i njegov tajmer
-    ADC12CTL1 = ADC12SHP;               // setujem  single-channel-single-conversion mod preko SHP-a
-    ADC12MCTL0 = ADC12INCH_14;          // koristim kanal 14 za ocitavanje
-    ADC12CTL0 |= ADC12ENC;              // enable-ujem konverziju
-    ADC12IE |= ADC12IE0;                // i konacno ovde enable-ujem interrupt za memorijsku lokaciju MEM0
+    ADC12CTL0 = ADC12ON | ADC12SHT0_8;  // ukljucujem AD konvertor i njegov tajmer (bez MSC, svaka konverzija ceka okidac)
+    ADC12CTL1 = ADC12SHS_1 | ADC12SHP | ADC12CONSEQ_3; // okidac TA0.1, repeat-sequence-of-channels mod
+    for(i = 0; i < ADC_SAMPLES; i++){
+        (&ADC12MCTL0)[i] = ADC12INCH_14; // koristim kanal 14 za ocitavanje u svim lokacijama sekvence
+    }
+    (&ADC12MCTL0)[ADC_SAMPLES - 1] |= ADC12EOS; // poslednja lokacija zatvara sekvencu
+    ADC12IE |= ADC12IE7;                // i konacno ovde enable-ujem interrupt samo za poslednju lokaciju MEM7
+                                        // (ADC12ENC se ukljucuje samo dok se biraju simboli)
 
 
     // selektovanje ulaza za USCI-UART serijsku komunikaciju
@@ -225,13 +704,22 @@ int main(void)
     UCA0CTL1 |= UCSWRST;                // Setujemo softverski reset
     UCA0CTL0 = 0;
     UCA0CTL1 = UCSSEL__SMCLK | UCSWRST; // koristimo SMCLK kao takt za generisanje bitske ucestanosti
-    UCA0BRW = 54;                       // BR = 54
-    UCA0MCTL = UCBRS_5;                 // BRS = 5 za 19200 bps baudrate
+    UCA0BRW = UART_UCBRW;               // delioci za UART_BAUD pri CLOCK_MCLK_HZ (clock.h)
+    UCA0MCTL = UART_UCA0MCTL;
     UCA0CTL1 &= ~UCSWRST;               // 'Resetujemo' softverski reset
-    UCA0IFG = 0;                        // brisanje interrupt flag-a za svaki slucaj, da nije ostalo od ranije
-    UCA0IE |= UCTXIE | UCRXIE;          // enable-ovanje TX i RX interrupt-a
+    UCA0IFG &= ~UCRXIFG;                // brisanje RX flag-a za svaki slucaj; UCTXIFG ostaje postavljen (TX bafer prazan, vidi HAL_UART_TX_DMA)
+    UCA0IE |= UCRXIE;                   // enable-ovanje RX interrupt-a (TX radi DMA, bez prekida po bajtu)
 
-    UCA0TXBUF = 0;                      // "Praznjenje" TX bafera
+    /**
+     *
+     * Inicijalizacija DMA kanala 0 za slanje poruka: okidac UCA0TXIFG, jedan bajt po
+     * okidacu iz kruznog bafera (adresa raste) u UCA0TXBUF (adresa fiksna), i jedan
+     * prekid na kraju prenosa. Adresu izvora i duzinu upisuje uart_tx.c za svaki prenos.
+     *
+     */
+    DMACTL0 = DMA0TSEL_17;              // UCA0TXIFG
+    DMA0DAL = (unsigned int)&UCA0TXBUF;
+    DMA0CTL = DMADT_0 | DMASRCINCR_3 | DMASBDB | DMAIE;  // okidanje na ivicu UCA0TXIFG (HAL_UART_TX_DMA)
 
 
     /**
@@ -241,29 +729,34 @@ int main(void)
      */
    __enable_interrupt();
 
+    PROFILE_INIT();
+
+    // poruka za novu igru se salje odmah po pokretanju aplikacije
+    new_game_print();
+
     // prolazak kroz odredjena stanja masine stanja realizovan je okviru while petlje
     while (1)
     {
+        commands_process();
+        events_process();
+
+        PROFILE_STATE_BEGIN(current_state);
+
         if(current_state == GENERATE_COMBINATION){
             /**
              *
              * Stanje GENERATE_COMBINATION:
-             * (u ovo stanje se dospeva nakon ucitanog karaktera 'n' i
-             *  posle toga nakon klika na taster S3)
-             * - nasumicno se generise kombinacija za novu igru
+             * (u ovo stanje se dospeva nakon komande 'n' i
+             *  posle toga nakon klika na taster S3 ili ponovljene komande 'n')
+             * - nasumicno se generise kombinacija za novu igru (combination_generate
+             *   uzima vrednost iz skupa entropije, bez cekanja)
              * - resetuje se brojac za pokusaje u okviru jedne igre
              * - reinicijalizuju se trenutno birana kombinacija i promenljiva za
              *   pracenje indeksa u toj kombinaciji
              * - po zavrsetku izvrsavanja ovog koda, prelazi se u stanje START
              *
              */
-            combination = combination_generate();
-
-            cnt_attempts = 0;
-
-            current_combination = 0;
-            current_combination_index = 4;
-            current_state = START;
+            game_start();
         }
         else if(current_state == START){
             /**
@@ -276,60 +769,175 @@ int main(void)
              *   pracenje indeksa u toj kombinaciji
              * - resetovanje rezultata provere kombinacija
              * - na LED displeje se ispisuju sve nule
-             * - nakon zavrsetka ispisa, prelazi se u stanje SELECT_SYMBOL u kojem
+             * - prelazi se u stanje SELECT_SYMBOL u kojem
              *   se omogucuje AD konverzija sa potenciometra P1 i ceka se klik na taster
              *   S2 za selektovanje upravo tog simbola
              *
              */
             current_combination = 0;
-            current_combination_index = 4;
+            current_combination_index = COMBINATION_LENGTH;
             result = 0;
 
-            display_index = LED_display_print(display_index, 0);
+            display_clear();
 
-            if(display_index == 0){
-                display_index = 4;
-                current_state = SELECT_SYMBOL;
-            }
+            ADC12CTL0 |= ADC12ENC;  // tajmer od sada pokrece AD konverzije
+
+            current_state = SELECT_SYMBOL;
 
         }else if(current_state == PROCESS_SYMBOL){
             /**
              *
              * Stanje PROCESS_SYMBOL:
              * (u ovo stanje se ulazi iz stanje SELECT_SYMBOL klikom na taster S2)
-             * - simbol, dobijen AD konverzijom, se mapira na simbole iz skupa {1,2,3,4,5,6}
+             * - preuzima se simbol iz skupa {1,2,3,4,5,6}, koji je prekidna rutina AD
+             *   konvertora vec mapirala uz histerezis (ad_symbol), a dogadjaj tastera S2
+             *   ga je zapamtio u trenutku pritiska (current_symbol)
              * - taj simbol se dodaje u trenutnu kombinaciju
              * - trenutna kombinacija se ispisuje na LED displej
              * - nakon zavrsenog ispisa, uporedjuju se kombinacije i inkrementira se brojac
              *   pokusaja
-             * - prelazi se u stanje PRINT_RESULT u UART interrupt (UART_serial)
-             * - prazni se TX bafer
+             * - prelazi se u stanje PRINT_RESULT
              *
              */
             if(current_combination_index > 0){
 
-                current_symbol = ADC_symbol_map(ad_result);
-
                 current_combination += symbol_push(current_combination_index, current_symbol);
 
                 current_combination_index = LED_display_print(current_combination_index, current_symbol);
 
                 if(current_combination_index == 0){
-                    cnt_attempts++;
-                    result = combination_check(current_combination, combination);
-
-                    current_combination_index = 4;
-                    current_state = PRINT_RESULT;
-
-                    UCA0TXBUF = 0;
+                    attempt_finish();
                 }else{
                     current_state = SELECT_SYMBOL;
                 }
             }
+        }else if(current_state == PRINT_RESULT){
+            /**
+             *
+             * Stanje PRINT_RESULT:
+             * (u ovo stanje se ulazi iz stanja PROCESS_SYMBOL nakon izabrana sva 4 simbola,
+             *  ili nakon pokusaja otkucanog preko serijske veze)
+             * - u bafer za slanje se upisuje poruka o rezultatu pokusaja:
+             *   - izabrana kombinacija
+             *   - broj skroz tacno pogodjenih simbola
+             *   - broj simbola na pogresnom mestu
+             *   - redni broj pokusaja u okviru jedne igre
+             * - ukoliko je kombinacija pogodjena ili su potroseni svi pokusaji, upisuje se i
+             *   poruka sa finalnim rezultatom i prelazi se u stanje END, u suprotnom u stanje START
+             * - ukoliko u baferu trenutno nema mesta za poruku, ostaje se u ovom stanju
+             *   i upis se ponavlja u sledecem prolasku kroz petlju
+             *
+             */
+            if(step_results_print(current_combination, result, cnt_attempts)){
+                if(game_over()){
+                    current_state = END;
+                }
+                else{
+                    current_state = START;
+                }
+            }else{
+                wake_on_tx = 1;
+            }
+        }else if(current_state == END){
+            /**
+             *
+             * Stanje END:
+             * - jednom se upisuje poruka sa finalnim rezultatom igre i poruka sa vremenom
+             *   aktivnog rada i spavanja u toku igre (uz ponavljanje ukoliko u baferu nema mesta),
+             *   nakon cega se ceka karakter 'n' preko serijske veze
+             *
+             */
+            if(!final_result_printed){
+                unsigned long game_ticks = timestamp_now() - game_start_time;
+
+                if(final_results_print(combination, result)){
+                    power_active_ms = TIMESTAMP_TO_MS(game_ticks - sleep_ticks);
+                    power_sleep_ms = TIMESTAMP_TO_MS(sleep_ticks);
+                    power_stats_pending = 1;
+                    final_result_printed = 1;
+                }else{
+                    wake_on_tx = 1;
+                }
+            }
+        }
+
+        if(power_stats_pending){
+            // poruka se ponavlja i ako je u medjuvremenu (komanda 'n') napusteno stanje END
+            if(power_stats_print(power_active_ms, power_sleep_ms)){
+                power_stats_pending = 0;
+            }else{
+                wake_on_tx = 1;
+            }
+        }
+
+#if SOLVER_ENABLED
+        if(hint_requested){
+            /**
+             *
+             * Komanda 'h' (predlog sledeceg pokusaja):
+             * - resavac racuna predlog, a trajanje racunanja se meri preko timestamp_now()
+             * - zahtev se brise tek kada je poruka upisana u bafer za slanje
+             *
+             */
+            unsigned long hint_start;
+            combination_t hint;
+            unsigned long hint_time;
+
+            PROFILE_BEGIN(PROFILE_SITE_HINT);
+            hint_start = timestamp_now();
+            hint = solver_hint();
+            hint_time = timestamp_now() - hint_start;
+
+
+            if(hint_print(hint, solver_remaining(), TIMESTAMP_TO_MS(hint_time))){
+                hint_requested = 0;
+            }else{
+                wake_on_tx = 1;
+            }
+            PROFILE_END(PROFILE_SITE_HINT);
+        }
+#endif
+
+        if(stats_requested){
+            unsigned long remaining = COMBINATION_CODE_COUNT;
+
+#if SOLVER_ENABLED
+            remaining = solver_remaining();
+#endif
+            if(stats_print(games_played, games_won, cnt_attempts, remaining,
+                           TIMESTAMP_TO_MS(event_latency_max), button_events.lost + uart_rx_dropped())){
+                stats_requested = 0;
+            }else{
+                wake_on_tx = 1;
+            }
+        }
+
+        if(frame_reply_pending){
+            if(frame_reply_write(frame_scores, frame_reply_count)){
+                frame_reply_pending = 0;
+            }else{
+                wake_on_tx = 1;
+            }
+        }
+
+        if(error_requested){
+            if(command_error_print()){
+                error_requested = 0;
+            }else{
+                wake_on_tx = 1;
+            }
         }
 
-        // dodat je neznatan delay u petlji da ne bi doslo do prekomerne upotrebe resursa
-        __delay_cycles(20);
+#ifdef PROFILE
+        if(profile_dump_pending() && profile_dump_step() == 0){
+            wake_on_tx = 1;
+        }
+#endif
+
+        PROFILE_STATE_END();
+
+        // umesto aktivnog cekanja, procesor spava dok ga neka prekidna rutina ne probudi
+        main_sleep();
     }
 
 	return 0;
@@ -338,58 +946,99 @@ int main(void)
  *
  * @brief Prekidna rutina za tastere S2 i S3
  *
- * Taster S2 sluzi za selektovanje simbola
- * Taster S3 sluzi za pokretanje nove igre nakon zavrsene prethodne
+ * Rutina samo belezi ivicu: tasteri koji su okinuli se iskljucuju (P2IE) dok traje
+ * debounce interval, a pritisak se obradjuje tek u prekidnoj rutini Debounce_interrupt.
  *
  */
 void __attribute__ ((interrupt(PORT2_VECTOR))) Buttons_interrupt (void){
+    unsigned char pins;
 
-    __delay_cycles(500);
+    PROFILE_BEGIN(PROFILE_SITE_BUTTONS);
+    pins = P2IFG & (BIT5 | BIT6);
 
-    /**
-     *
-     * Provera za taster S2:
-     * - ukoliko smo u stanju SELECT_SYMBOL i kliknemo na taster S2 da potvrdimo simbol,
-     *   prelazimo u stanje PROCESS_SYMBOL
-     * - nakon provere se brise interrupt flag za ovaj taster
-     *
-    */
+    // trenutak ivice zavisi od korisnika, pa je stanje brojaca tajmera dobar izvor entropije
+    entropy_add(TA0R);
 
-    if ((P2IFG & BIT5) != 0){
-        if ((current_state == SELECT_SYMBOL) && ((P2IN & BIT5) == 0)){
-            current_state = PROCESS_SYMBOL;
-        }
-        P2IFG &= ~BIT5;
+    P2IE &= ~pins;
+    P2IFG &= ~pins;
+
+    debounce_pins |= pins;
+    debounce_count = DEBOUNCE_PERIODS;
+    TA0CCTL2 = CCIE;
+
+    PROFILE_END(PROFILE_SITE_BUTTONS);
+    return;
+}
+/**
+ *
+ * @brief Prekidna rutina za debounce tastera S2 i S3
+ *
+ * Poziva se na svaki CCR2 tajmera TA0 (jednom po periodi) dok traje debounce interval.
+ * Po isteku intervala ponovo se citaju tasteri, pritisnuti tasteri se prijavljuju
+ * masini stanja, a interrupt tastera se ponovo ukljucuje.
+ *
+ * Taster S2 sluzi za selektovanje simbola
+ * Taster S3 sluzi za pokretanje nove igre nakon zavrsene prethodne
+ *
+ */
+void __attribute__ ((interrupt(TIMER0_A1_VECTOR))) Debounce_interrupt (void){
+    unsigned long now;
+    unsigned char pins;
+    unsigned char pressed;
+
+    PROFILE_BEGIN(PROFILE_SITE_DEBOUNCE);
+
+    if(TA0IV != TA0IV_TA0CCR2 || --debounce_count != 0){
+        PROFILE_END(PROFILE_SITE_DEBOUNCE);
+        return;
     }
 
+    TA0CCTL2 = 0;
+    pins = debounce_pins;
+    debounce_pins = 0;
+    pressed = pins & ~P2IN;  // tasteri su aktivni na nuli
+
     /**
      *
-     * Provera za taster S3:
-     * - ukoliko smo u stanju WAIT_FOR_NEW_GAME i kliknemo na taster S3 da bismo pokrenuli novu igru,
-     *   prelazimo u stanje GENERATE_COMBINATION
-     * - nakon provere se brise interrupt flag za ovaj taster
+     * Pritisci se samo upisuju u red dogadjaja, a da li menjaju stanje odlucuje
+     * glavni program (events_process):
+     * - taster S2 potvrdjuje simbol (u stanju SELECT_SYMBOL prelazi se u PROCESS_SYMBOL);
+     *   uz dogadjaj se pamti simbol koji je AD konvertor mapirao u trenutku pritiska
+     * - taster S3 pokrece novu igru (u stanju WAIT_FOR_NEW_GAME prelazi se u GENERATE_COMBINATION)
      *
     */
-
-    if ((P2IFG & BIT6) != 0){
-        if ((current_state == WAIT_FOR_NEW_GAME) && ((P2IN & BIT6) == 0)){
-            current_state = GENERATE_COMBINATION;
-        }
-        P2IFG &= ~BIT6;
+    now = timestamp_now();
+    if((pressed & BIT5) != 0){
+        event_put(&button_events, EVENT_BUTTON_S2, ad_symbol, now);
     }
+    if((pressed & BIT6) != 0){
+        event_put(&button_events, EVENT_BUTTON_S3, 0, now);
+    }
+
+    // tasteri se ponovo naoruzavaju; ivice nastale tokom intervala se odbacuju
+    P2IFG &= ~pins;
+    P2IE |= pins;
 
+    // glavni program se budi samo ako ima dogadjaj za obradu
+    if(pressed != 0){
+        __bic_SR_register_on_exit(LPM3_bits);
+    }
 
+    PROFILE_END(PROFILE_SITE_DEBOUNCE);
     return;
 }
 /**
  *
  * @brief Prekidna rutina za UART serijsku komunikaciju
  *
- * Realizuje se citanje iz RX bafera i slanje poruka preko TX bafera u
- * zavisnosti od trenutnog stanje masine stanja
+ * Realizuje se citanje iz RX bafera. Poruke se salju preko DMA kanala 0
+ * (prekidna rutina DMA_interrupt), pa TX prekid nije ukljucen.
  *
  */
 void __attribute__ ((interrupt(USCI_A0_VECTOR))) UART_serial (void){
+    unsigned char character;
+
+    PROFILE_BEGIN(PROFILE_SITE_UART);
 
     switch (UCA0IV){
     case 0:
@@ -397,62 +1046,91 @@ void __attribute__ ((interrupt(USCI_A0_VECTOR))) UART_serial (void){
     case 2:
         /**
          *
-         * Citanje poruka iz RX bafera
-         * Ukoliko smo u stanju IDLE (dakle, na pocetku pri prvom pokretanju igre) ili
-         * u stanju END (na kraju igre, nakon pogotka ili nakon neuspesno iskoriscenih
-         * svih 6 mogucih pokusaja) i ucitamo karakter 'n', onda reinicijalizujemo duzinu
-         * poruke za finalne rezultate (dodatni feature) i prelazimo u stanje WAIT_FOR_NEW_GAME,
-         * gde cekamo klik na tasteru S3.
+         * Citanje iz RX bafera
+         * Primljen bajt se samo upisuje u kruzni bafer za prijem (uart_rx.c), pa ni bajtovi
+         * koji stignu jedan za drugim (npr. zalepljen niz pokusaja) se ne gube. Komande tumaci
+         * i izvrsava glavni program (commands_process), koji se zato budi.
          *
         */
+        character = UCA0RXBUF;
+        uart_rx_isr(character);
 
-        // Ulazna vrednost sa terminala
-        input_character = UCA0RXBUF;
+        // vreme prijema bajta se umesava u skup entropije
+        entropy_add(TA0R ^ ((unsigned int)character << 8));
 
-        if ((current_state == IDLE || current_state == END) && input_character == 'n'){
-            final_result_string_length = 46;
-            current_state = WAIT_FOR_NEW_GAME;
-        }
+        __bic_SR_register_on_exit(LPM3_bits);
         break;
-    case 4:
-        /**
-         *
-         * Slanje poruka preko TX bafera
-         * Ukoliko smo u stanju IDLE na terminal saljemo poruku za novu igru.
-         * Ukoliko smo u stanju END na terminal saljemo poruku za finalne rezultate igre.
-         * Ukoliko smo u stanju PRINT_RESULT na terminal saljemo sledecu poruku:
-         * - izabrana kombinacija
-         * - broj skroz tacno pogodjenih simbola (i simbol i pozicija tog simbola su pogodjeni) - kao u igri Slagalica
-         * - broj simbola na pogresnom mestu
-         * - redni broj pokusaja u okviru jedne igre
-         *
-         * U stanju PRINT_RESULT, nakon zavrsenog ispisa proveravamo rezultate igre.
-         * Dakle, ukoliko smo pogodili kombinaciju ili smo potrosili moguce pokusaje neuspesno,
-         * prelazimo u stanje END, u kojem cekamo novu igru ukoliko korisnik to zeli.
-         * Ukoliko nismo ni pogodili kombinaciju, niti smo iskoristili sve pokusaje,
-         * vracamo se u stanje START.
-         *
-        */
+    }
 
-        if(current_state == IDLE){
-            new_game_string_length = new_game_print(new_game_string_length);
-        }
-        else if (current_state == END){
-            final_result_string_length = final_results_print(combination, result, final_result_string_length);
-        }
-        else if(current_state == PRINT_RESULT){
-            step_result_string_length = step_results_print(current_combination, result, cnt_attempts, step_result_string_length);
+    PROFILE_END(PROFILE_SITE_UART);
+    return ;
+}
+/**
+ *
+ * @brief Prekidna rutina DMA kontrolera
+ *
+ * Sve poruke (nova igra, rezultat pokusaja, finalni rezultat) glavni program upisuje
+ * u kruzni bafer za slanje, a DMA kanal 0 ih bajt po bajt prenosi u UCA0TXBUF. Prekid
+ * stize jednom na kraju prenosa: ovde se oslobadja poslat deo bafera i pokrece prenos
+ * onoga sto je upisano u medjuvremenu.
+ *
+ */
+void __attribute__ ((interrupt(DMA_VECTOR))) DMA_interrupt (void){
+    PROFILE_BEGIN(PROFILE_SITE_DMA);
 
-            if(step_result_string_length == 0){
-                step_result_string_length = 17;
-                if(result == 400 || cnt_attempts == 6){
-                    current_state = END;
-                }
-                else{
-                    current_state = START;
-                }
-            }
+    if(DMAIV == DMAIV_DMA0IFG){
+        uart_tx_isr();
+
+        // bafer za slanje je prazan, a glavni program ceka mesto za poruku
+        if(wake_on_tx && uart_tx_pending() == 0){
+            wake_on_tx = 0;
+            __bic_SR_register_on_exit(LPM3_bits);
         }
     }
-    return ;
+
+    PROFILE_END(PROFILE_SITE_DMA);
+}
+#ifdef ISR_C_FALLBACK
+/**
+ *
+ * @brief C verzije prekidnih rutina tajmera i AD konvertora
+ *
+ * Ekvivalent rutina CCR0ISR i ADC12ISR iz fajla ISR.asm, koji se koristi kada se projekat
+ * prevede sa --define=ISR_C_FALLBACK (tada se asemblerske rutine izostavljaju). Sluzi
+ * za poredjenje broja ciklusa i ponasanja dve verzije u simulatoru.
+ *
+ */
+void __attribute__ ((interrupt(TIMER0_A0_VECTOR))) CCR0ISR (void){
+    unsigned int index;
+
+    PROFILE_BEGIN(PROFILE_SITE_CCR0);
+    index = display_scan;
+    timer_ticks++;
+
+    P11OUT |= BIT1 | BIT0;
+    P10OUT |= BIT7 | BIT6;
+    P6OUT = display_framebuffer[index];
+    P11OUT &= ~display_select_p11[index];
+    P10OUT &= ~display_select_p10[index];
+
+    display_scan = (index + 1) & 3;
+    PROFILE_END(PROFILE_SITE_CCR0);
+}
+
+void __attribute__ ((interrupt(ADC12_VECTOR))) ADC12ISR (void){
+    unsigned int sum;
+
+    PROFILE_BEGIN(PROFILE_SITE_ADC12);
+    if(ADC12IV == ADC12IV_ADC12IFG7){
+        sum = ADC12MEM0 + ADC12MEM1 + ADC12MEM2 + ADC12MEM3 +
+              ADC12MEM4 + ADC12MEM5 + ADC12MEM6 + ADC12MEM7;
+
+        entropy_adc ^= sum;
+        entropy_adc = (entropy_adc << 1) | (entropy_adc >> 15);
+
+        ad_result = sum >> 3;
+        ad_symbol = ADC_symbol_map(ad_result, ad_symbol);
+    }
+    PROFILE_END(PROFILE_SITE_ADC12);
 }
+#endif
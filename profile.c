@@ -0,0 +1,114 @@
+#include "profile.h"
+
+#ifdef PROFILE
+
+#include <string.h>
+
+#include "combination.h"
+#include "hal.h"
+#include "uart_tx.h"
+
+/**
+ * @brief Statistika jednog mesta
+ *
+ * Ukupno trajanje se deli brojem poziva tek prilikom slanja tabele.
+ *
+ */
+struct profile_site {
+    unsigned long count;
+    unsigned long total;
+    unsigned int min;
+    unsigned int max;
+};
+
+volatile unsigned int profile_start[PROFILE_SITES];
+unsigned int profile_state_site;
+
+static struct profile_site profile_sites[PROFILE_SITES];
+static volatile unsigned int profile_dump_site = PROFILE_SITES;
+
+static const char profile_names[PROFILE_SITES][6] = {
+    {'B','U','T','T','O','N'}, {'D','E','B','N','C','E'}, {'U','A','R','T',' ',' '},
+    {'C','C','R','0',' ',' '}, {'A','D','C','1','2',' '}, {'H','I','N','T',' ',' '},
+    {'D','M','A',' ',' ',' '}, {'I','D','L','E',' ',' '}, {'W','A','I','T',' ',' '},
+    {'G','E','N','E','R',' '}, {'S','T','A','R','T',' '}, {'S','E','L','E','C','T'},
+    {'P','R','O','C','E','S'}, {'R','E','S','U','L','T'}, {'E','N','D',' ',' ',' '}
+};
+/**
+ * @brief Sablon reda tabele i pozicije polja u njemu
+ *
+ */
+static const char profile_message[] = "PRF ------ n:00000000 min:00000 max:00000 avg:00000\n";
+#define PROFILE_NAME_SLOT       (4)
+#define PROFILE_COUNT_SLOT      (13)
+#define PROFILE_MIN_SLOT        (26)
+#define PROFILE_MAX_SLOT        (36)
+#define PROFILE_AVG_SLOT        (46)
+
+void profile_init(void){
+    unsigned int i;
+
+    for(i = 0; i < PROFILE_SITES; i++){
+        profile_sites[i].min = 0xFFFF;
+    }
+    TB0CTL = TBSSEL__SMCLK | MC__CONTINUOUS | TBCLR;
+}
+
+void profile_end(unsigned int site){
+    unsigned int elapsed = TB0R - profile_start[site];
+    struct profile_site *entry = &profile_sites[site];
+    unsigned short irq_state;
+
+    HAL_IRQ_SAVE(irq_state);
+    entry->count++;
+    entry->total += elapsed;
+    if(elapsed < entry->min){
+        entry->min = elapsed;
+    }
+    if(elapsed > entry->max){
+        entry->max = elapsed;
+    }
+    HAL_IRQ_RESTORE(irq_state);
+}
+
+void profile_dump_start(void){
+    profile_dump_site = 0;
+}
+
+unsigned int profile_dump_pending(void){
+    return profile_dump_site < PROFILE_SITES;
+}
+
+unsigned int profile_dump_step(void){
+    char message[sizeof(profile_message) - 1];
+    struct profile_site snapshot;
+    unsigned int site = profile_dump_site;
+    unsigned short irq_state;
+
+    if(site >= PROFILE_SITES){
+        return 1;
+    }
+
+    HAL_IRQ_SAVE(irq_state);
+    snapshot = profile_sites[site];
+    HAL_IRQ_RESTORE(irq_state);
+
+    if(snapshot.count == 0){
+        snapshot.min = 0;
+    }
+
+    memcpy(message, profile_message, sizeof(message));
+    memcpy(&message[PROFILE_NAME_SLOT], profile_names[site], sizeof(profile_names[site]));
+    decimal_write(&message[PROFILE_COUNT_SLOT], snapshot.count, 8);
+    decimal_write(&message[PROFILE_MIN_SLOT], snapshot.min, 5);
+    decimal_write(&message[PROFILE_MAX_SLOT], snapshot.max, 5);
+    decimal_write(&message[PROFILE_AVG_SLOT], snapshot.count ? snapshot.total / snapshot.count : 0, 5);
+
+    if(uart_tx_write(message, sizeof(message)) == 0){
+        return 0;
+    }
+    profile_dump_site = site + 1;
+    return 1;
+}
+
+#endif /* PROFILE */
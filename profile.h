@@ -0,0 +1,125 @@
+#ifndef PROFILE_H_
+#define PROFILE_H_
+/**
+ * @brief Profilisanje prekidnih rutina i stanja glavnog programa
+ *
+ * Kada se projekat prevede sa --define=PROFILE, na ulazu i izlazu svakog mesta
+ * (prekidne rutine, racunanje predloga i svako stanje glavnog programa) cita se
+ * brojac tajmera TB0, koji slobodno broji takt SMCLK (= MCLK), pa je razlika
+ * upravo broj ciklusa procesora. Za svako mesto pamte se broj poziva, najkrace,
+ * najduze i ukupno trajanje, a tabela se salje preko UART-a na komandu 'p'.
+ *
+ * Stanje glavnog programa se meri od pocetka do kraja jednog prolaza kroz petlju
+ * (PROFILE_STATE_BEGIN/PROFILE_STATE_END), i pripisuje stanju u kojem je prolaz poceo.
+ * Trajanje stanja glavnog programa ukljucuje i prekidne rutine koje su se desile
+ * u medjuvremenu. Merenje je ograniceno na 65535 ciklusa (jedan krug brojaca TB0).
+ *
+ * Bez simbola PROFILE svi makroi su prazni i ne generisu nikakav kod.
+ *
+ */
+#define PROFILE_SITE_BUTTONS        (0)
+#define PROFILE_SITE_DEBOUNCE       (1)
+#define PROFILE_SITE_UART           (2)
+#define PROFILE_SITE_CCR0           (3)
+#define PROFILE_SITE_ADC12          (4)
+#define PROFILE_SITE_HINT           (5)
+#define PROFILE_SITE_DMA            (6)
+#define PROFILE_SITE_STATE(state)   (7 + (state) - 1)   // stanja IDLE (1) do END (8)
+#define PROFILE_SITES               (15)
+
+#ifdef PROFILE
+
+#include <msp430.h>
+
+#define PROFILE_INIT()              profile_init()
+#define PROFILE_BEGIN(site)         (profile_start[(site)] = TB0R)
+#define PROFILE_END(site)           profile_end(site)
+#define PROFILE_STATE_BEGIN(state)  (profile_state_site = PROFILE_SITE_STATE(state), PROFILE_BEGIN(profile_state_site))
+#define PROFILE_STATE_END()         profile_end(profile_state_site)
+
+extern volatile unsigned int profile_start[PROFILE_SITES];
+extern unsigned int profile_state_site;
+/**
+ * @brief Funkcija profile_init
+ *
+ * - opis:
+ *      Funkcija pokrece tajmer TB0 u continuous modu sa taktom SMCLK.
+ *
+ * - argumenti:
+ *      nema
+ *
+ * - povratna vrednost:
+ *      nema
+ *
+ */
+extern void profile_init(void);
+/**
+ * @brief Funkcija profile_end
+ *
+ * - opis:
+ *      Funkcija racuna trajanje od PROFILE_BEGIN za zadato mesto i azurira statistiku.
+ *      Poziva se i iz prekidnih rutina (i iz ISR.asm).
+ *
+ * - argumenti:
+ *      - site - mesto koje se meri (PROFILE_SITE_*)
+ *
+ * - povratna vrednost:
+ *      nema
+ *
+ */
+extern void profile_end(unsigned int site);
+/**
+ * @brief Funkcija profile_dump_start
+ *
+ * - opis:
+ *      Funkcija zapocinje (ili ponovo zapocinje) slanje tabele profilisanja.
+ *
+ * - argumenti:
+ *      nema
+ *
+ * - povratna vrednost:
+ *      nema
+ *
+ */
+extern void profile_dump_start(void);
+/**
+ * @brief Funkcija profile_dump_pending
+ *
+ * - opis:
+ *      Funkcija proverava da li je ostalo jos redova tabele za slanje.
+ *
+ * - argumenti:
+ *      nema
+ *
+ * - povratna vrednost:
+ *      1 ako slanje tabele nije zavrseno, 0 inace.
+ *
+ */
+extern unsigned int profile_dump_pending(void);
+/**
+ * @brief Funkcija profile_dump_step
+ *
+ * - opis:
+ *      Funkcija upisuje sledeci red tabele u bafer za slanje. Poziva se iz glavnog
+ *      programa dok profile_dump_pending ne vrati 0.
+ *
+ * - argumenti:
+ *      nema
+ *
+ * - povratna vrednost:
+ *      1 ako je red upisan u bafer za slanje, 0 ako nema mesta.
+ *
+ */
+extern unsigned int profile_dump_step(void);
+
+#else
+
+#define PROFILE_INIT()
+#define PROFILE_BEGIN(site)
+#define PROFILE_END(site)
+#define PROFILE_STATE_BEGIN(state)
+#define PROFILE_STATE_END()
+
+#endif /* PROFILE */
+
+#endif /* PROFILE_H_ */
@@ -0,0 +1,167 @@
+#include "combination.h"
+#include "candidates.h"
+#include "decision_tree.h"
+#include "solver.h"
+
+#if SOLVER_ENABLED
+
+/**
+ * @brief Broj mogucih kombinacija
+ *
+ * Moguce kombinacije su u bitset-u iz candidates.c (162 bajta za igru 4 x 6); ovde se
+ * cuva samo njihov broj posle poslednjeg prolaza, da se ne broji ponovo.
+ *
+ */
+static unsigned int solver_candidate_count = 0;
+/**
+ * @brief Trenutni cvor u stablu odlucivanja
+ *
+ * Dok god korisnik igra po predlozima iz stabla (decision_tree.c), predlog se cita
+ * direktno iz cvora. Cim se odigra pokusaj koji nije iz stabla, prelazi se na
+ * racunanje predloga u toku rada (SOLVER_TREE_NONE). Stablo postoji samo za igru
+ * 4 x 6 (DECISION_TREE_AVAILABLE); u ostalim konfiguracijama predlog se uvek racuna.
+ *
+ */
+#if DECISION_TREE_AVAILABLE
+#define SOLVER_TREE_NONE    (0xFFFF)
+
+static unsigned int solver_tree_node = SOLVER_TREE_NONE;
+#endif
+
+/**
+ * @brief Funkcija solver_tree_descend
+ *
+ * - opis:
+ *      Prelazi iz trenutnog cvora stabla u dete za dobijeni rezultat.
+ *      Indeks deteta je first_child plus broj postojecih dece sa manjom klasom.
+ *
+ */
+static void solver_tree_descend(combination_t guess, unsigned int result){
+#if DECISION_TREE_AVAILABLE
+    const decision_tree_node *node;
+    unsigned int class_index, below;
+
+    if(solver_tree_node == SOLVER_TREE_NONE){
+        return;
+    }
+
+    node = &decision_tree[solver_tree_node];
+    class_index = decision_tree_class[RESULT_SCORED(result) * 5 + RESULT_WRONG_PLACE(result)];
+
+    if(node->guess != guess || class_index == DECISION_TREE_NO_CLASS
+       || (node->children & (1u << class_index)) == 0){
+        solver_tree_node = SOLVER_TREE_NONE;
+        return;
+    }
+
+    solver_tree_node = node->first_child;
+    for(below = node->children & ((1u << class_index) - 1); below != 0; below &= below - 1){
+        solver_tree_node++;
+    }
+#else
+    (void)guess;
+    (void)result;
+#endif
+}
+
+/**
+ * @brief Funkcija result_class
+ *
+ * - opis:
+ *      Preslikava upakovan rezultat na indeks u histogramu rezultata [0;SOLVER_RESULT_CLASSES - 1].
+ *
+ */
+static unsigned int result_class(unsigned int result){
+    return RESULT_SCORED(result) * (COMBINATION_LENGTH + 1) + RESULT_WRONG_PLACE(result);
+}
+
+void solver_reset(void){
+    candidates_reset();
+    solver_candidate_count = SOLVER_CODE_COUNT;
+#if DECISION_TREE_AVAILABLE
+    solver_tree_node = 0;
+#endif
+}
+
+unsigned int solver_record(combination_t guess, unsigned int result){
+    solver_candidate_count = candidates_prune(guess, result);
+    solver_tree_descend(guess, result);
+
+    return solver_candidate_count;
+}
+
+combination_t solver_hint(void){
+    unsigned int histogram[SOLVER_RESULT_CLASSES];
+    unsigned int guess_count, stride;
+    unsigned int g, k, skip;
+    candidates_iterator guess_iterator, candidate_iterator;
+    unsigned int more;
+    combination_t best_guess;
+    unsigned int best_worst;
+
+#if DECISION_TREE_AVAILABLE
+    if(solver_tree_node != SOLVER_TREE_NONE){
+        return decision_tree[solver_tree_node].guess;
+    }
+#endif
+    if(solver_candidate_count == SOLVER_CODE_COUNT){
+        return SOLVER_FIRST_GUESS;
+    }
+    if(solver_candidate_count <= 2){
+        // sa jednom ili dve moguce kombinacije, bilo koja od njih je optimalna
+        return candidates_first(&guess_iterator) ? guess_iterator.combination : SOLVER_FIRST_GUESS;
+    }
+
+    // koliko pokusaja moze da se proveri u okviru budzeta
+    guess_count = (unsigned int)(SOLVER_CHECK_BUDGET / solver_candidate_count);
+    if(guess_count == 0){
+        guess_count = 1;
+    }
+    if(guess_count > solver_candidate_count){
+        guess_count = solver_candidate_count;
+    }
+    stride = solver_candidate_count / guess_count;
+
+    candidates_first(&guess_iterator);
+    best_guess = guess_iterator.combination;
+    best_worst = 0xFFFF;
+
+    // pokusaji su moguce kombinacije sa rednim brojem 0, stride, 2 * stride, ...
+    for(g = 0; g < guess_count; g++){
+        combination_t guess = guess_iterator.combination;
+        unsigned int worst = 0;
+
+        for(k = 0; k < SOLVER_RESULT_CLASSES; k++){
+            histogram[k] = 0;
+        }
+
+        for(more = candidates_first(&candidate_iterator); more; more = candidates_next(&candidate_iterator)){
+            unsigned int size = ++histogram[result_class(combination_check(guess, candidate_iterator.combination))];
+
+            if(size > worst){
+                worst = size;
+                // ova grupa je vec veca od najboljeg, pokusaj se odbacuje
+                if(worst >= best_worst){
+                    break;
+                }
+            }
+        }
+
+        if(worst < best_worst){
+            best_worst = worst;
+            best_guess = guess;
+        }
+
+        for(skip = stride; skip != 0; skip--){
+            candidates_next(&guess_iterator);
+        }
+    }
+
+    return best_guess;
+}
+
+unsigned int solver_remaining(void){
+    return solver_candidate_count;
+}
+
+#endif /* SOLVER_ENABLED */
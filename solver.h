@@ -0,0 +1,118 @@
+#ifndef SOLVER_H_
+#define SOLVER_H_
+/**
+ * @brief Resavac za komandu "hint"
+ *
+ * Resavac prati pokusaje iz trenutne igre i listu kombinacija koje su jos moguce
+ * (konzistentne sa svim dosadasnjim rezultatima). Na zahtev predlaze pokusaj po
+ * Knuth-ovom minimax kriterijumu: bira se pokusaj kod kojeg je najveca grupa
+ * preostalih kombinacija (za isti rezultat) najmanja. Kao "orakl" za rezultat
+ * koristi se combination_check.
+ *
+ * Dok se igra po predlozima, predlog se cita iz unapred izracunatog stabla
+ * odlucivanja u flash memoriji (decision_tree.c) u O(1). Tek kada korisnik odigra
+ * drugaciji pokusaj, predlog se racuna u toku rada, u okviru budzeta SOLVER_CHECK_BUDGET.
+ *
+ */
+#include "clock.h"
+#include "combination.h"
+
+#define SOLVER_CODE_COUNT       ((unsigned int)COMBINATION_CODE_COUNT)  // 6^4 = 1296 kombinacija
+#define SOLVER_FIRST_GUESS      (COMBINATION_LSB_MASK + (COMBINATION_LSB_MASK >> (4 * ((COMBINATION_LENGTH + 1) / 2))))
+                                            // 1122 za 4 x 6 (Knuth-ov optimalan prvi pokusaj), 11122 za 5 pozicija
+#define SOLVER_RESULT_CLASSES   ((COMBINATION_LENGTH + 1) * (COMBINATION_LENGTH + 1))
+                                            // indeks klase: (COMBINATION_LENGTH + 1) * tacni + na pogresnom mestu
+/**
+ * @brief Dostupnost resavaca
+ *
+ * Skup mogucih kombinacija (candidates.h, SOLVER_CODE_COUNT bita) je u RAM-u, a jedan
+ * prolaz kroz njega traje oko 200 ciklusa po kombinaciji: na mikrokontroleru je granica
+ * 4096 kombinacija (npr. 4 x 8, 512 bajta i ~0.8 s po prolazu), a na host-u 32768 (npr. 5 x 8).
+ * Za vece igre SOLVER_ENABLED je 0, resavac se ne prevodi, a komanda 'h' se ignorise.
+ *
+ */
+#ifdef HOST_BUILD
+#define SOLVER_MAX_CODE_COUNT   (32768)
+#else
+#define SOLVER_MAX_CODE_COUNT   (4096)
+#endif
+
+#if COMBINATION_CODE_COUNT <= SOLVER_MAX_CODE_COUNT
+#define SOLVER_ENABLED          (1)
+#else
+#define SOLVER_ENABLED          (0)
+#endif
+/**
+ * @brief Budzet provera po jednom zahtevu
+ *
+ * Najveci broj poziva combination_check u toku jednog racunanja predloga.
+ * Jedan poziv zajedno sa petljom traje oko 200 ciklusa, pa je 2048 provera po MHz
+ * takta MCLK (CLOCK_MCLK_HZ) oko 0.4 s, nezavisno od izabrane ucestanosti.
+ * Ukoliko je preostalih kombinacija previse, kao kandidati za pokusaj se uzima samo
+ * ravnomerno rasporedjen podskup.
+ *
+ */
+#ifndef SOLVER_CHECK_BUDGET
+#define SOLVER_CHECK_BUDGET     (2048UL * (CLOCK_MCLK_HZ / 1000000UL))
+#endif
+/**
+ * @brief Funkcija solver_reset
+ *
+ * - opis:
+ *      Funkcija vraca resavac na pocetak igre: sve kombinacije su moguce.
+ *
+ * - argumenti:
+ *      nema
+ *
+ * - povratna vrednost:
+ *      nema
+ *
+ */
+extern void solver_reset(void);
+/**
+ * @brief Funkcija solver_record
+ *
+ * - opis:
+ *      Funkcija belezi odigran pokusaj i njegov rezultat i iz liste mogucih kombinacija
+ *      izbacuje sve koje nisu konzistentne sa njim.
+ *
+ * - argumenti:
+ *      - guess - odigrana kombinacija
+ *      - result - rezultat dobijen funkcijom combination_check
+ *
+ * - povratna vrednost:
+ *      Broj preostalih mogucih kombinacija.
+ *
+ */
+extern unsigned int solver_record(combination_t guess, unsigned int result);
+/**
+ * @brief Funkcija solver_hint
+ *
+ * - opis:
+ *      Funkcija predlaze sledeci pokusaj po minimax kriterijumu, u okviru budzeta
+ *      SOLVER_CHECK_BUDGET poziva combination_check.
+ *
+ * - argumenti:
+ *      nema
+ *
+ * - povratna vrednost:
+ *      Predlozena upakovana kombinacija.
+ *
+ */
+extern combination_t solver_hint(void);
+/**
+ * @brief Funkcija solver_remaining
+ *
+ * - opis:
+ *      Funkcija vraca broj kombinacija koje su jos moguce.
+ *
+ * - argumenti:
+ *      nema
+ *
+ * - povratna vrednost:
+ *      Broj preostalih mogucih kombinacija.
+ *
+ */
+extern unsigned int solver_remaining(void);
+
+#endif /* SOLVER_H_ */
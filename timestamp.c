@@ -0,0 +1,31 @@
+#include "hal.h"
+#include "timestamp.h"
+
+/**
+ * @brief Brojac perioda tajmera TA0
+ *
+ * Inkrementira ga prekidna rutina CCR0ISR u fajlu ISR.asm.
+ *
+ */
+volatile unsigned long timer_ticks = 0;
+
+unsigned long timestamp_now(void){
+#ifdef HOST_BUILD
+    return hal_host_timestamp();
+#else
+    unsigned long ticks;
+    unsigned int pending;
+    unsigned int count;
+
+    // ukoliko se prekid tajmera desi izmedju dva citanja (ili izmedju citanja dve reci
+    // brojaca timer_ticks), ili se CCIFG postavi izmedju citanja zastavice i TA0R,
+    // citanje se ponavlja
+    do{
+        ticks = timer_ticks;
+        pending = HAL_TIMER_PERIOD_PENDING();
+        count = HAL_TIMER_READ();
+    }while(ticks != timer_ticks || pending != HAL_TIMER_PERIOD_PENDING());
+
+    return TIMESTAMP_COMPOSE(ticks, pending, count);
+#endif
+}
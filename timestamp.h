@@ -0,0 +1,57 @@
+#ifndef TIMESTAMP_H_
+#define TIMESTAMP_H_
+/**
+ * @brief Vremenske oznake
+ *
+ * Tajmer TA0 broji ACLK periode (32768 Hz) u up modu do TIMER_PERIOD, a prekidna rutina
+ * CCR0ISR (ISR.asm) na svaki period inkrementira 32-bitni brojac timer_ticks. Spajanjem ove
+ * dve vrednosti dobija se 32-bitni brojac ACLK perioda koji se koristi za merenje trajanja.
+ * Brojac se premotava tek posle 2^32 ACLK perioda (oko 36 sati), pa su razlike dve
+ * oznake (unsigned long) ispravne i kada igra traje duze od 2 minuta.
+ *
+ */
+#define TIMESTAMP_FREQUENCY     (32768UL)
+#define TIMESTAMP_PERIOD        (64UL)     // TIMER_PERIOD + 1
+/**
+ * @brief Spajanje brojaca perioda i stanja tajmera
+ *
+ * CCIFG kanala CCR0 se postavlja kada TA0R dostigne TIMER_PERIOD, a ne kada se vrati na 0,
+ * pa CCR0ISR uveca timer_ticks dok TA0R jos ima vrednost TIMER_PERIOD. Zato se stanje
+ * tajmera broji od te ACLK periode: TIMER_PERIOD daje 0, a 0 daje 1. Dok prekid ceka
+ * (pending, npr. u drugoj prekidnoj rutini), timer_ticks jos nije uvecan za periodu koja
+ * se upravo zavrsila, pa se ona dodaje ovde. Oznaka tako nikada ne ide unazad, sve dok
+ * prekid ne ceka duze od jedne periode tajmera (oko 2 ms).
+ *
+ */
+#define TIMESTAMP_COMPOSE(ticks, pending, count) \
+        (((unsigned long)(ticks) + ((pending) ? 1UL : 0UL)) * TIMESTAMP_PERIOD \
+         + (((unsigned long)(count) + 1UL) & (TIMESTAMP_PERIOD - 1UL)))
+/**
+ * @brief Konverzija ACLK perioda u milisekunde
+ *
+ * Cele sekunde i ostatak se racunaju odvojeno, kako mnozenje sa 1000 ne bi prekoracilo
+ * 32 bita za trajanja duza od oko 131 s.
+ *
+ */
+#define TIMESTAMP_TO_MS(ticks)  (((unsigned long)(ticks) / TIMESTAMP_FREQUENCY) * 1000UL \
+                                 + ((unsigned long)(ticks) % TIMESTAMP_FREQUENCY) * 1000UL / TIMESTAMP_FREQUENCY)
+
+extern volatile unsigned long timer_ticks;
+/**
+ * @brief Funkcija timestamp_now
+ *
+ * - opis:
+ *      Funkcija vraca broj ACLK perioda od pokretanja tajmera (TIMESTAMP_COMPOSE). Poziva
+ *      se iz glavnog programa ili iz prekidne rutine; tada timer_ticks miruje, pa se
+ *      perioda ciji prekid ceka racuna preko zastavice CCIFG.
+ *
+ * - argumenti:
+ *      nema
+ *
+ * - povratna vrednost:
+ *      Trenutna vremenska oznaka u ACLK periodama.
+ *
+ */
+extern unsigned long timestamp_now(void);
+
+#endif /* TIMESTAMP_H_ */
@@ -0,0 +1,54 @@
+#include <stdint.h>
+
+#include "uart_rx.h"
+
+/**
+ * @brief Kruzni bafer za prijem
+ *
+ * Upisuje samo prekidna rutina (uart_rx_isr), a cita samo glavni program (uart_rx_read),
+ * pa je dovoljno da svaka strana menja samo svoj indeks:
+ * - uart_rx_head    - indeks sledeceg slobodnog mesta, menja ga prekidna rutina
+ * - uart_rx_tail    - indeks sledeceg bajta za citanje, menja ga glavni program
+ * - uart_rx_lost    - broj odbacenih bajtova, menja ga prekidna rutina
+ * Bafer je volatile kao i indeksi, kako kompajler ne bi pomerio upis bajta iza upisa
+ * uart_rx_head, niti citanje bajta ispred citanja uart_rx_head.
+ *
+ */
+static volatile unsigned char uart_rx_buffer[UART_RX_BUFFER_SIZE];
+static volatile uint8_t uart_rx_head = 0;
+static volatile uint8_t uart_rx_tail = 0;
+static volatile unsigned int uart_rx_lost = 0;
+
+unsigned int uart_rx_isr(unsigned char byte){
+    uint8_t head = uart_rx_head;
+    uint8_t next = (head + 1) & UART_RX_BUFFER_MASK;
+
+    if(next == uart_rx_tail){
+        uart_rx_lost++;
+        return 0;
+    }
+
+    uart_rx_buffer[head] = byte;
+    uart_rx_head = next;
+    return 1;
+}
+
+unsigned int uart_rx_read(unsigned char *byte){
+    uint8_t tail = uart_rx_tail;
+
+    if(tail == uart_rx_head){
+        return 0;
+    }
+
+    *byte = uart_rx_buffer[tail];
+    uart_rx_tail = (tail + 1) & UART_RX_BUFFER_MASK;
+    return 1;
+}
+
+unsigned int uart_rx_pending(void){
+    return (uart_rx_head - uart_rx_tail) & UART_RX_BUFFER_MASK;
+}
+
+unsigned int uart_rx_dropped(void){
+    return uart_rx_lost;
+}
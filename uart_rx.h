@@ -0,0 +1,72 @@
+#ifndef UART_RX_H_
+#define UART_RX_H_
+/**
+ * @brief Velicina kruznog bafera za prijem
+ *
+ * Mora biti stepen broja 2, jer se indeksi "premotavaju" maskom.
+ * Prekidna rutina samo upisuje primljen bajt u bafer, a bajtove cita i tumaci
+ * glavni program (command.c), pa se bajtovi koji stignu jedan za drugim ne gube.
+ * U bafer staje nekoliko komandi (npr. "1234\n" za vise pokusaja zaredom).
+ *
+ */
+#define UART_RX_BUFFER_SIZE     (64)
+#define UART_RX_BUFFER_MASK     (UART_RX_BUFFER_SIZE - 1)
+/**
+ * @brief Funkcija uart_rx_isr
+ *
+ * - opis:
+ *      Funkcija se poziva iz UART prekidne rutine za svaki primljen bajt i upisuje ga
+ *      u kruzni bafer. Ukoliko je bafer pun, bajt se odbacuje i broji (uart_rx_dropped).
+ *
+ * - argumenti:
+ *      - byte - primljen bajt (UCA0RXBUF)
+ *
+ * - povratna vrednost:
+ *      1 ako je bajt upisan, 0 ako je odbacen.
+ *
+ */
+extern unsigned int uart_rx_isr(unsigned char byte);
+/**
+ * @brief Funkcija uart_rx_read
+ *
+ * - opis:
+ *      Funkcija skida sledeci primljen bajt iz kruznog bafera. Poziva je samo glavni program.
+ *
+ * - argumenti:
+ *      - byte - pokazivac na mesto za procitan bajt
+ *
+ * - povratna vrednost:
+ *      1 ako je bajt procitan, 0 ako je bafer prazan.
+ *
+ */
+extern unsigned int uart_rx_read(unsigned char *byte);
+/**
+ * @brief Funkcija uart_rx_pending
+ *
+ * - opis:
+ *      Funkcija vraca broj primljenih bajtova koji cekaju na obradu.
+ *
+ * - argumenti:
+ *      nema
+ *
+ * - povratna vrednost:
+ *      Broj bajtova u kruznom baferu.
+ *
+ */
+extern unsigned int uart_rx_pending(void);
+/**
+ * @brief Funkcija uart_rx_dropped
+ *
+ * - opis:
+ *      Funkcija vraca broj bajtova odbacenih zbog punog bafera od pokretanja.
+ *
+ * - argumenti:
+ *      nema
+ *
+ * - povratna vrednost:
+ *      Broj odbacenih bajtova.
+ *
+ */
+extern unsigned int uart_rx_dropped(void);
+
+#endif /* UART_RX_H_ */
@@ -0,0 +1,75 @@
+#include <stdint.h>
+
+#include "hal.h"
+#include "uart_tx.h"
+
+/**
+ * @brief Kruzni bafer za slanje
+ *
+ * Upisuje samo glavni program (uart_tx_write), a bajtove u TX bafer prenosi DMA kanal 0,
+ * pa je dovoljno da svaka strana menja samo svoj indeks:
+ * - uart_tx_head    - indeks sledeceg slobodnog mesta, menja ga glavni program
+ * - uart_tx_tail    - indeks prvog bajta koji jos nije poslat, menja ga prekidna rutina
+ *                     tek kada se prenos zavrsi, pa se bajtovi u prenosu ne mogu pregaziti
+ * - uart_tx_flight  - broj bajtova u prenosu koji je DMA kanal upravo pokrenut;
+ *                     0 znaci da predajnik miruje
+ *
+ */
+static char uart_tx_buffer[UART_TX_BUFFER_SIZE];
+static volatile uint8_t uart_tx_head = 0;
+static volatile uint8_t uart_tx_tail = 0;
+static volatile uint8_t uart_tx_flight = 0;
+
+// pokrece prenos najduzeg neprekinutog dela bafera od uart_tx_tail (poziva se sa zabranjenim prekidima)
+static void uart_tx_start(void){
+    uint8_t tail = uart_tx_tail;
+    uint8_t head = uart_tx_head;
+    uint8_t length;
+
+    if(tail == head){
+        uart_tx_flight = 0;
+        return;
+    }
+
+    // deo koji prelazi kraj bafera salje se u sledecem prenosu
+    length = (head > tail) ? (uint8_t)(head - tail) : (uint8_t)(UART_TX_BUFFER_SIZE - tail);
+    uart_tx_flight = length;
+    HAL_UART_TX_DMA(&uart_tx_buffer[tail], length);
+}
+
+unsigned int uart_tx_write(const char *data, unsigned int length){
+    unsigned int i;
+    unsigned int free_space;
+    unsigned short irq_state;
+    uint8_t head = uart_tx_head;
+
+    free_space = (uart_tx_tail - head - 1) & UART_TX_BUFFER_MASK;
+    if(length > free_space){
+        return 0;
+    }
+
+    for(i = 0; i < length; i++){
+        uart_tx_buffer[head] = data[i];
+        head = (head + 1) & UART_TX_BUFFER_MASK;
+    }
+
+    // pokretanje prenosa mora biti atomicno u odnosu na prekidnu rutinu,
+    // inace bi se isti deo bafera mogao poslati dva puta
+    HAL_IRQ_SAVE(irq_state);
+    uart_tx_head = head;
+    if(uart_tx_flight == 0){
+        uart_tx_start();
+    }
+    HAL_IRQ_RESTORE(irq_state);
+
+    return 1;
+}
+
+void uart_tx_isr(void){
+    uart_tx_tail = (uart_tx_tail + uart_tx_flight) & UART_TX_BUFFER_MASK;
+    uart_tx_start();
+}
+
+unsigned int uart_tx_pending(void){
+    return (uart_tx_head - uart_tx_tail) & UART_TX_BUFFER_MASK;
+}
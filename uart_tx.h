@@ -0,0 +1,62 @@
+#ifndef UART_TX_H_
+#define UART_TX_H_
+/**
+ * @brief Velicina kruznog bafera za slanje
+ *
+ * Mora biti stepen broja 2, jer se indeksi "premotavaju" maskom.
+ * U bafer staje vise poruka odjednom (npr. rezultat pokusaja i finalni rezultat igre),
+ * pa poruke ne "gaze" jedna drugu.
+ *
+ */
+#define UART_TX_BUFFER_SIZE     (128)
+#define UART_TX_BUFFER_MASK     (UART_TX_BUFFER_SIZE - 1)
+/**
+ * @brief Funkcija uart_tx_write
+ *
+ * - opis:
+ *      Funkcija upisuje celu poruku u kruzni bafer za slanje i, ukoliko predajnik
+ *      ne radi, pokrece DMA prenos poruke u TX bafer (okidac UCA0TXIFG), bez prekida
+ *      po bajtu. Poruka se upisuje ili cela ili nikako.
+ *
+ * - argumenti:
+ *      - data - pokazivac na poruku
+ *      - length - duzina poruke u bajtovima
+ *
+ * - povratna vrednost:
+ *      1 ako je poruka upisana, 0 ako u baferu nema dovoljno mesta.
+ *
+ */
+extern unsigned int uart_tx_write(const char *data, unsigned int length);
+/**
+ * @brief Funkcija uart_tx_isr
+ *
+ * - opis:
+ *      Funkcija se poziva iz DMA prekidne rutine kada je prenos zavrsen (jednom po
+ *      poruci, ili dva puta ako poruka prelazi kraj bafera). Oslobadja poslate bajtove
+ *      i pokrece prenos svih bajtova upisanih u medjuvremenu. Ukoliko je kruzni bafer
+ *      prazan, predajnik se oznacava kao slobodan.
+ *
+ * - argumenti:
+ *      nema
+ *
+ * - povratna vrednost:
+ *      nema
+ *
+ */
+extern void uart_tx_isr(void);
+/**
+ * @brief Funkcija uart_tx_pending
+ *
+ * - opis:
+ *      Funkcija vraca broj bajtova koji cekaju na slanje.
+ *
+ * - argumenti:
+ *      nema
+ *
+ * - povratna vrednost:
+ *      Broj bajtova u kruznom baferu.
+ *
+ */
+extern unsigned int uart_tx_pending(void);
+
+#endif /* UART_TX_H_ */